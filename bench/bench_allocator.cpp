@@ -0,0 +1,684 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <list>
+#include <memory>
+#include <map>
+#include <new>
+#include <numeric>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "allocator.hpp"
+#include "btree_map-type_container.hpp"
+#include "indexed_list-type_container.hpp"
+#include "inline_allocator.hpp"
+#include "mapped_list-type_container.hpp"
+#include "monotonic_allocator.hpp"
+#include "pool_memory_resource.hpp"
+#include "slab_allocator.hpp"
+#include "unidir_list-type_container.hpp"
+#include "unrolled_list-type_container.hpp"
+
+// std::allocator против FixedAllocator (и SlabAllocator с классами размеров)
+// на std::map, MyBTreeMapTypeContainer,
+// std::list, MyUniDirListTypeContainer (ещё и с MonotonicAllocator и
+// с PoolMemoryResource через std::pmr),
+// MyUnrolledListTypeContainer и MyIndexedListTypeContainer:
+// insert, erase, iterate, clear; для map — ещё поиск.
+// Отдельно — доступ по индексу к MyUniDirListTypeContainer:
+// последовательный и случайный, с разреженным индексом и без.
+// И полный цикл жизни маленьких map и списков (SMALL_SIZE элементов):
+// куча, FixedAllocator и InlineAllocator с пулом на стеке.
+// Параллельная свёртка по списку в 1..8 потоках.
+// Большие пулы на огромных страницах (ChunkBacking::HugePages) против
+// кучи: обход списка, узлы которого перемешаны по памяти (обычный и с
+// предвыборкой по контрольным точкам), и поиск в std::map.
+// Старт с данными: построение PoolMyList поэлементно против повторного
+// открытия MyMappedListTypeContainer из файла (плюс обход в обоих случаях).
+// Время операции меряется вручную (без подготовки контейнера),
+// выводятся ns/op и число обращений к глобальному operator new на операцию.
+
+namespace {
+
+std::atomic<std::size_t> heap_allocations{0};
+
+}  // namespace
+
+// Подсчёт обращений к куче — их и экономит пул
+void* operator new(std::size_t size) {
+    heap_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, std::align_val_t align) {
+    heap_allocations.fetch_add(1, std::memory_order_relaxed);
+    const auto alignment = static_cast<std::size_t>(align);
+    const std::size_t rounded = (size + alignment - 1) / alignment * alignment;
+    if (void* ptr = std::aligned_alloc(alignment, rounded == 0 ? alignment
+                                                               : rounded)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept {
+    std::free(ptr);
+}
+
+namespace {
+
+constexpr std::size_t POOL_SIZE = 1024;
+// Шаг контрольных точек — точек разбиения списка для parallel_*
+constexpr std::size_t PARALLEL_STRIDE = 4096;
+// Обход с предвыборкой: участков в группе и шаг индекса — группа из
+// 8 * 1024 узлов помещается в L2
+constexpr std::size_t SCAN_PREFETCH_LANES = 8;
+constexpr std::size_t SCAN_CHECKPOINT_STRIDE = 1024;
+// Ёмкость пула списка с индексными ссылками — наибольший размер замера
+constexpr std::size_t INDEXED_CAPACITY = 10'000'000;
+
+template <typename T>
+using PoolAllocator = FixedAllocator<T, POOL_SIZE, GrowthPolicy::Geometric>;
+template <typename T>
+using HugePoolAllocator = FixedAllocator<T, POOL_SIZE, GrowthPolicy::Geometric,
+                                         ChunkBacking::HugePages>;
+template <typename T>
+using PrefaultPoolAllocator =
+    FixedAllocator<T, POOL_SIZE, GrowthPolicy::Geometric,
+                   ChunkBacking::HugePagesPrefault>;
+
+using StdMap = std::map<int, int>;
+using PoolMap = std::map<int, int, std::less<int>,
+                         PoolAllocator<std::pair<const int, int>>>;
+using BTreeMap = MyBTreeMapTypeContainer<int, int>;
+using PoolBTreeMap =
+    MyBTreeMapTypeContainer<int, int, std::less<int>,
+                            PoolAllocator<std::pair<const int, int>>>;
+using SlabMap = std::map<int, int, std::less<int>,
+                         SlabAllocator<std::pair<const int, int>, POOL_SIZE>>;
+using StdList = std::list<int>;
+using PoolList = std::list<int, PoolAllocator<int>>;
+using StdMyList = MyUniDirListTypeContainer<int>;
+using PoolMyList = MyUniDirListTypeContainer<int, PoolAllocator<int>>;
+using SlabMyList =
+    MyUniDirListTypeContainer<int, SlabAllocator<int, POOL_SIZE>>;
+using HugePoolMap = std::map<int, int, std::less<int>,
+                             HugePoolAllocator<std::pair<const int, int>>>;
+using HugePoolMyList = MyUniDirListTypeContainer<int, HugePoolAllocator<int>>;
+using PrefaultPoolMyList =
+    MyUniDirListTypeContainer<int, PrefaultPoolAllocator<int>>;
+// Список на std::pmr со своим PoolMemoryResource: ресурс объявлен
+// раньше списка и переживает его
+struct PmrPoolMyList {
+    PoolMemoryResource resource{POOL_SIZE, GrowthPolicy::Geometric};
+    MyPmrUniDirListTypeContainer<int> list{&resource};
+
+    void clear() {
+        list.clear();
+    }
+};
+using MonotonicMyList =
+    MyUniDirListTypeContainer<int, MonotonicAllocator<int, POOL_SIZE>>;
+using StdUnrolledList = MyUnrolledListTypeContainer<int>;
+using PoolUnrolledList = MyUnrolledListTypeContainer<int, PoolAllocator<int>>;
+using IndexedList = MyIndexedListTypeContainer<int, INDEXED_CAPACITY>;
+using MappedList = MyMappedListTypeContainer<int, INDEXED_CAPACITY>;
+
+// Маленькие короткоживущие контейнеры — как в демонстрации main.cpp
+constexpr std::size_t SMALL_SIZE = 10;
+
+using MapValue = std::pair<const int, int>;
+using SmallPoolMapAllocator = FixedAllocator<MapValue, SMALL_SIZE>;
+using SmallInlineMapAllocator = InlineAllocator<MapValue, SMALL_SIZE>;
+using SmallPoolListAllocator = FixedAllocator<int, SMALL_SIZE>;
+using SmallInlineListAllocator = InlineAllocator<int, SMALL_SIZE>;
+
+using SmallPoolMap =
+    std::map<int, int, std::less<int>, SmallPoolMapAllocator>;
+using SmallInlineMap =
+    std::map<int, int, std::less<int>, SmallInlineMapAllocator>;
+using SmallPoolMyList =
+    MyUniDirListTypeContainer<int, SmallPoolListAllocator>;
+using SmallInlineMyList =
+    MyUniDirListTypeContainer<int, SmallInlineListAllocator>;
+
+// Единый интерфейс операций над контейнерами
+template <typename Container>
+struct ContainerOps;
+
+template <typename Compare, typename Alloc>
+struct ContainerOps<std::map<int, int, Compare, Alloc>> {
+    using Container = std::map<int, int, Compare, Alloc>;
+    static void insert(Container& container, int key) {
+        container.emplace(key, key);
+    }
+    static void erase(Container& container, int key) {
+        container.erase(key);
+    }
+    static long long sum(const Container& container) {
+        long long result = 0;
+        for (const auto& pair : container) {
+            result += pair.second;
+        }
+        return result;
+    }
+};
+
+template <typename Compare, typename Alloc, std::size_t NodeBytes>
+struct ContainerOps<MyBTreeMapTypeContainer<int, int, Compare, Alloc,
+                                            NodeBytes>> {
+    using Container =
+        MyBTreeMapTypeContainer<int, int, Compare, Alloc, NodeBytes>;
+    static void insert(Container& container, int key) {
+        container.try_emplace(key, key);
+    }
+    static void erase(Container& container, int key) {
+        container.erase(key);
+    }
+    static long long sum(const Container& container) {
+        long long result = 0;
+        for (const auto& pair : container) {
+            result += pair.second;
+        }
+        return result;
+    }
+};
+
+template <typename Alloc>
+struct ContainerOps<std::list<int, Alloc>> {
+    using Container = std::list<int, Alloc>;
+    static void insert(Container& container, int key) {
+        container.push_back(key);
+    }
+    static void erase(Container& container, int) {
+        container.pop_front();
+    }
+    static long long sum(const Container& container) {
+        return std::accumulate(container.begin(), container.end(), 0LL);
+    }
+};
+
+template <typename Alloc>
+struct ContainerOps<MyUniDirListTypeContainer<int, Alloc>> {
+    using Container = MyUniDirListTypeContainer<int, Alloc>;
+    static void insert(Container& container, int key) {
+        container.push_back(key);
+    }
+    static void erase(Container& container, int) {
+        container.erase(0);
+    }
+    static long long sum(const Container& container) {
+        return std::accumulate(container.begin(), container.end(), 0LL);
+    }
+};
+
+template <>
+struct ContainerOps<PmrPoolMyList> {
+    static void insert(PmrPoolMyList& container, int key) {
+        container.list.push_back(key);
+    }
+    static void erase(PmrPoolMyList& container, int) {
+        container.list.erase(0);
+    }
+    static long long sum(const PmrPoolMyList& container) {
+        return std::accumulate(container.list.begin(), container.list.end(),
+                               0LL);
+    }
+};
+
+template <typename Alloc, std::size_t Capacity>
+struct ContainerOps<MyUnrolledListTypeContainer<int, Alloc, Capacity>> {
+    using Container = MyUnrolledListTypeContainer<int, Alloc, Capacity>;
+    static void insert(Container& container, int key) {
+        container.push_back(key);
+    }
+    static void erase(Container& container, int) {
+        container.erase(0);
+    }
+    static long long sum(const Container& container) {
+        return std::accumulate(container.begin(), container.end(), 0LL);
+    }
+};
+
+template <std::size_t N, typename Alloc>
+struct ContainerOps<MyIndexedListTypeContainer<int, N, Alloc>> {
+    using Container = MyIndexedListTypeContainer<int, N, Alloc>;
+    static void insert(Container& container, int key) {
+        container.push_back(key);
+    }
+    static void erase(Container& container, int) {
+        container.erase(0);
+    }
+    static long long sum(const Container& container) {
+        return std::accumulate(container.begin(), container.end(), 0LL);
+    }
+};
+
+template <typename T, std::size_t N>
+struct ContainerOps<MyMappedListTypeContainer<T, N>> {
+    using Container = MyMappedListTypeContainer<T, N>;
+    static void insert(Container& container, int key) {
+        container.push_back(key);
+    }
+    static long long sum(const Container& container) {
+        return std::accumulate(container.begin(), container.end(), 0LL);
+    }
+};
+
+// Ключи в случайном порядке (для std::map это важно)
+const std::vector<int>& shuffledKeys(std::size_t count) {
+    static std::map<std::size_t, std::vector<int>> cache;
+    auto& keys = cache[count];
+    if (keys.size() != count) {
+        keys.resize(count);
+        std::iota(keys.begin(), keys.end(), 0);
+        std::shuffle(keys.begin(), keys.end(), std::mt19937{42});
+    }
+    return keys;
+}
+
+template <typename Container>
+void fill(Container& container, const std::vector<int>& keys) {
+    for (const int key : keys) {
+        ContainerOps<Container>::insert(container, key);
+    }
+}
+
+// Замер одной операции над всеми элементами; setup — вне замера
+template <typename Container, typename Setup, typename Operation>
+void measure(benchmark::State& state, Setup setup, Operation operation) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const auto& keys = shuffledKeys(count);
+    std::size_t allocations = 0;
+    double seconds = 0;
+    for (auto _ : state) {
+        auto container = std::make_unique<Container>();
+        setup(*container, keys);
+        const std::size_t before =
+            heap_allocations.load(std::memory_order_relaxed);
+        const auto start = std::chrono::steady_clock::now();
+        operation(*container, keys);
+        const auto finish = std::chrono::steady_clock::now();
+        allocations +=
+            heap_allocations.load(std::memory_order_relaxed) - before;
+        const double elapsed =
+            std::chrono::duration<double>(finish - start).count();
+        seconds += elapsed;
+        state.SetIterationTime(elapsed);
+        benchmark::DoNotOptimize(container.get());
+    }
+    const auto ops = static_cast<double>(state.iterations()) *
+                     static_cast<double>(count);
+    state.SetItemsProcessed(static_cast<std::int64_t>(ops));
+    state.counters["ns/op"] = seconds * 1e9 / ops;
+    state.counters["allocs/op"] = static_cast<double>(allocations) / ops;
+}
+
+template <typename Container>
+void BM_Insert(benchmark::State& state) {
+    measure<Container>(
+        state, [](Container&, const std::vector<int>&) {},
+        [](Container& container, const std::vector<int>& keys) {
+            fill(container, keys);
+        });
+}
+
+template <typename Container>
+void BM_Erase(benchmark::State& state) {
+    measure<Container>(
+        state,
+        [](Container& container, const std::vector<int>& keys) {
+            fill(container, keys);
+        },
+        [](Container& container, const std::vector<int>& keys) {
+            for (const int key : keys) {
+                ContainerOps<Container>::erase(container, key);
+            }
+        });
+}
+
+template <typename Container>
+void BM_Iterate(benchmark::State& state) {
+    measure<Container>(
+        state,
+        [](Container& container, const std::vector<int>& keys) {
+            fill(container, keys);
+        },
+        [](Container& container, const std::vector<int>&) {
+            benchmark::DoNotOptimize(ContainerOps<Container>::sum(container));
+        });
+}
+
+template <typename Container>
+void BM_Clear(benchmark::State& state) {
+    measure<Container>(
+        state,
+        [](Container& container, const std::vector<int>& keys) {
+            fill(container, keys);
+        },
+        [](Container& container, const std::vector<int>&) {
+            container.clear();
+        });
+}
+
+// Индексы — та же перестановка ключей 0..count-1
+template <typename Container, bool Checkpoints>
+void fillIndexed(Container& container, const std::vector<int>& keys) {
+    fill(container, keys);
+    if constexpr (Checkpoints) {
+        container.enable_checkpoints();
+    }
+}
+
+template <typename Container, bool Checkpoints>
+void BM_IndexSequential(benchmark::State& state) {
+    measure<Container>(
+        state, fillIndexed<Container, Checkpoints>,
+        [](Container& container, const std::vector<int>&) {
+            long long sum = 0;
+            for (std::size_t i = 0; i < container.size(); ++i) {
+                sum += container[i];
+            }
+            benchmark::DoNotOptimize(sum);
+        });
+}
+
+template <typename Container, bool Checkpoints>
+void BM_IndexRandom(benchmark::State& state) {
+    measure<Container>(
+        state, fillIndexed<Container, Checkpoints>,
+        [](Container& container, const std::vector<int>& keys) {
+            long long sum = 0;
+            for (const int key : keys) {
+                sum += container[static_cast<std::size_t>(key)];
+            }
+            benchmark::DoNotOptimize(sum);
+        });
+}
+
+// Контейнер создаётся в области видимости вызова body; для
+// InlineAllocator рядом с ним на стеке объявляется пул
+template <typename Alloc>
+struct SmallScope {
+    template <typename Container, typename Body>
+    static void run(Body body) {
+        Container container;
+        body(container);
+    }
+};
+
+template <typename T, std::size_t N, std::size_t SlotSize>
+struct SmallScope<InlineAllocator<T, N, SlotSize>> {
+    template <typename Container, typename Body>
+    static void run(Body body) {
+        using Allocator = InlineAllocator<T, N, SlotSize>;
+        typename Allocator::pool_type pool;
+        Container container{Allocator{pool}};
+        body(container);
+    }
+};
+
+// Создать контейнер, заполнить SMALL_SIZE элементами, обойти, удалить
+template <typename Container, typename Alloc>
+void BM_SmallLifetime(benchmark::State& state) {
+    const std::size_t before = heap_allocations.load(std::memory_order_relaxed);
+    for (auto _ : state) {
+        SmallScope<Alloc>::template run<Container>([](Container& container) {
+            for (std::size_t i = 0; i < SMALL_SIZE; ++i) {
+                ContainerOps<Container>::insert(container,
+                                                static_cast<int>(i));
+            }
+            benchmark::DoNotOptimize(ContainerOps<Container>::sum(container));
+        });
+    }
+    const std::size_t allocations =
+        heap_allocations.load(std::memory_order_relaxed) - before;
+    state.counters["allocs/op"] = static_cast<double>(allocations) /
+                                  static_cast<double>(state.iterations());
+}
+
+// Узлы выделены подряд, после sort() по перемешанным ключам порядок
+// списка случаен относительно адресов — каждый шаг обхода это промах
+// кэша, а при большом пуле и промах TLB. Индекс строится вне замера
+// в обоих вариантах; PrefetchLanes = 0 — обычный обход
+template <typename Container, std::size_t PrefetchLanes>
+void BM_ScatteredScan(benchmark::State& state) {
+    measure<Container>(
+        state,
+        [](Container& container, const std::vector<int>& keys) {
+            fill(container, keys);
+            container.sort();
+            container.enable_checkpoints(SCAN_CHECKPOINT_STRIDE);
+            benchmark::DoNotOptimize(container[0]);
+        },
+        [](Container& container, const std::vector<int>&) {
+            long long sum = 0;
+            container.for_each([&sum](int value) { sum += value; },
+                               PrefetchLanes);
+            benchmark::DoNotOptimize(sum);
+        });
+}
+
+template <typename Container>
+void BM_Find(benchmark::State& state) {
+    measure<Container>(
+        state,
+        [](Container& container, const std::vector<int>& keys) {
+            fill(container, keys);
+        },
+        [](Container& container, const std::vector<int>& keys) {
+            long long sum = 0;
+            for (const int key : keys) {
+                sum += container.find(key)->second;
+            }
+            benchmark::DoNotOptimize(sum);
+        });
+}
+
+// Сумма по списку из range(0) элементов в range(1) потоках: участки —
+// по контрольным точкам через каждые PARALLEL_STRIDE узлов. Список
+// строится один раз, меряется только parallel_transform_reduce
+template <typename Container>
+void BM_ParallelSum(benchmark::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const auto threads = static_cast<std::size_t>(state.range(1));
+    Container container;
+    container.enable_checkpoints(PARALLEL_STRIDE);
+    fill(container, shuffledKeys(count));
+    for (auto _ : state) {
+        const auto start = std::chrono::steady_clock::now();
+        const long long sum = container.parallel_transform_reduce(
+            0LL, std::plus<>{},
+            [](int value) { return static_cast<long long>(value); }, threads);
+        const auto finish = std::chrono::steady_clock::now();
+        benchmark::DoNotOptimize(sum);
+        state.SetIterationTime(
+            std::chrono::duration<double>(finish - start).count());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Холодный старт: список строится поэлементно, затем обходится
+template <typename Container>
+void BM_Rebuild(benchmark::State& state) {
+    measure<Container>(
+        state, [](Container&, const std::vector<int>&) {},
+        [](Container& container, const std::vector<int>& keys) {
+            fill(container, keys);
+            benchmark::DoNotOptimize(ContainerOps<Container>::sum(container));
+        });
+}
+
+// Тёплый старт: список из count элементов уже лежит в файле (и в
+// страничном кэше ОС) — открыть и обойти
+void BM_MappedReopen(benchmark::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const std::string path =
+        (std::filesystem::temp_directory_path() /
+         ("bench_mapped_list_" + std::to_string(count) + ".bin"))
+            .string();
+    std::filesystem::remove(path);
+    {
+        MappedList list{path};
+        fill(list, shuffledKeys(count));
+        list.sync();
+    }
+    double seconds = 0;
+    for (auto _ : state) {
+        const auto start = std::chrono::steady_clock::now();
+        const MappedList list{path};
+        benchmark::DoNotOptimize(ContainerOps<MappedList>::sum(list));
+        const auto finish = std::chrono::steady_clock::now();
+        const double elapsed =
+            std::chrono::duration<double>(finish - start).count();
+        seconds += elapsed;
+        state.SetIterationTime(elapsed);
+    }
+    std::filesystem::remove(path);
+    const auto ops = static_cast<double>(state.iterations()) *
+                     static_cast<double>(count);
+    state.SetItemsProcessed(static_cast<std::int64_t>(ops));
+    state.counters["ns/op"] = seconds * 1e9 / ops;
+}
+
+constexpr std::int64_t MIN_ELEMENTS = 10;
+constexpr std::int64_t MAX_ELEMENTS = 10'000'000;
+// Случайный доступ без индекса квадратичен — диапазон меньше
+constexpr std::int64_t MAX_LINEAR_INDEXED = 10'000;
+constexpr std::int64_t MAX_INDEXED = 1'000'000;
+// Огромные страницы имеют смысл, когда пул больше покрытия TLB
+constexpr std::int64_t MIN_LARGE_POOL_ELEMENTS = 100'000;
+constexpr std::int64_t PARALLEL_ELEMENTS = 10'000'000;
+
+}  // namespace
+
+#define ALLOCATOR_BENCHMARK(operation, container) \
+    BENCHMARK_TEMPLATE(operation, container)      \
+        ->RangeMultiplier(10)                     \
+        ->Range(MIN_ELEMENTS, MAX_ELEMENTS)       \
+        ->UseManualTime()                         \
+        ->Unit(benchmark::kMicrosecond)
+
+#define ALLOCATOR_BENCHMARKS(container)         \
+    ALLOCATOR_BENCHMARK(BM_Insert, container);  \
+    ALLOCATOR_BENCHMARK(BM_Erase, container);   \
+    ALLOCATOR_BENCHMARK(BM_Iterate, container); \
+    ALLOCATOR_BENCHMARK(BM_Clear, container)
+
+// clear() за O(1) (сброс арены, пропуск тривиальных деструкторов):
+// ручное время почти нулевое, и подбор числа итераций по нему не
+// закончился бы — для очистки число итераций фиксировано
+constexpr std::int64_t CONSTANT_CLEAR_ITERATIONS = 10;
+
+#define CONSTANT_CLEAR_BENCHMARKS(container)                      \
+    ALLOCATOR_BENCHMARK(BM_Insert, container);                    \
+    ALLOCATOR_BENCHMARK(BM_Erase, container);                     \
+    ALLOCATOR_BENCHMARK(BM_Iterate, container);                   \
+    ALLOCATOR_BENCHMARK(BM_Clear, container)                      \
+        ->Iterations(CONSTANT_CLEAR_ITERATIONS)
+
+ALLOCATOR_BENCHMARKS(StdMap);
+ALLOCATOR_BENCHMARKS(PoolMap);
+ALLOCATOR_BENCHMARKS(SlabMap);
+ALLOCATOR_BENCHMARKS(BTreeMap);
+ALLOCATOR_BENCHMARKS(PoolBTreeMap);
+ALLOCATOR_BENCHMARK(BM_Find, StdMap);
+ALLOCATOR_BENCHMARK(BM_Find, PoolMap);
+ALLOCATOR_BENCHMARK(BM_Find, BTreeMap);
+ALLOCATOR_BENCHMARK(BM_Find, PoolBTreeMap);
+ALLOCATOR_BENCHMARKS(StdList);
+ALLOCATOR_BENCHMARKS(PoolList);
+ALLOCATOR_BENCHMARKS(StdMyList);
+ALLOCATOR_BENCHMARKS(PoolMyList);
+ALLOCATOR_BENCHMARKS(SlabMyList);
+ALLOCATOR_BENCHMARKS(PmrPoolMyList);
+CONSTANT_CLEAR_BENCHMARKS(MonotonicMyList);
+ALLOCATOR_BENCHMARKS(StdUnrolledList);
+ALLOCATOR_BENCHMARKS(PoolUnrolledList);
+CONSTANT_CLEAR_BENCHMARKS(IndexedList);
+
+#define INDEXED_BENCHMARK(operation, container, checkpoints, max_elements) \
+    BENCHMARK_TEMPLATE(operation, container, checkpoints)                  \
+        ->RangeMultiplier(10)                                              \
+        ->Range(MIN_ELEMENTS, max_elements)                                \
+        ->UseManualTime()                                                  \
+        ->Unit(benchmark::kMicrosecond)
+
+INDEXED_BENCHMARK(BM_IndexSequential, StdMyList, false, MAX_INDEXED);
+INDEXED_BENCHMARK(BM_IndexSequential, PoolMyList, false, MAX_INDEXED);
+INDEXED_BENCHMARK(BM_IndexRandom, StdMyList, false, MAX_LINEAR_INDEXED);
+INDEXED_BENCHMARK(BM_IndexRandom, PoolMyList, false, MAX_LINEAR_INDEXED);
+INDEXED_BENCHMARK(BM_IndexRandom, StdMyList, true, MAX_INDEXED);
+INDEXED_BENCHMARK(BM_IndexRandom, PoolMyList, true, MAX_INDEXED);
+
+#define LARGE_POOL_BENCHMARK(...)                      \
+    BENCHMARK_TEMPLATE(__VA_ARGS__)                    \
+        ->RangeMultiplier(10)                          \
+        ->Range(MIN_LARGE_POOL_ELEMENTS, MAX_ELEMENTS) \
+        ->UseManualTime()                              \
+        ->Unit(benchmark::kMicrosecond)
+
+LARGE_POOL_BENCHMARK(BM_Insert, HugePoolMyList);
+LARGE_POOL_BENCHMARK(BM_Insert, PrefaultPoolMyList);
+LARGE_POOL_BENCHMARK(BM_ScatteredScan, PoolMyList, 0);
+LARGE_POOL_BENCHMARK(BM_ScatteredScan, PoolMyList, SCAN_PREFETCH_LANES);
+LARGE_POOL_BENCHMARK(BM_ScatteredScan, HugePoolMyList, 0);
+LARGE_POOL_BENCHMARK(BM_ScatteredScan, HugePoolMyList, SCAN_PREFETCH_LANES);
+LARGE_POOL_BENCHMARK(BM_Find, PoolMap);
+LARGE_POOL_BENCHMARK(BM_Find, HugePoolMap);
+
+#define PARALLEL_BENCHMARK(container)                      \
+    BENCHMARK_TEMPLATE(BM_ParallelSum, container)          \
+        ->ArgNames({"elements", "threads"})                \
+        ->ArgsProduct({{PARALLEL_ELEMENTS}, {1, 2, 4, 8}}) \
+        ->UseManualTime()                                  \
+        ->Unit(benchmark::kMillisecond)
+
+PARALLEL_BENCHMARK(StdMyList);
+PARALLEL_BENCHMARK(PoolMyList);
+
+BENCHMARK_TEMPLATE(BM_Rebuild, PoolMyList)
+    ->RangeMultiplier(10)
+    ->Range(MIN_ELEMENTS, MAX_ELEMENTS)
+    ->UseManualTime()
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_MappedReopen)
+    ->RangeMultiplier(10)
+    ->Range(MIN_ELEMENTS, MAX_ELEMENTS)
+    ->UseManualTime()
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_TEMPLATE(BM_SmallLifetime, StdMap, std::allocator<MapValue>);
+BENCHMARK_TEMPLATE(BM_SmallLifetime, SmallPoolMap, SmallPoolMapAllocator);
+BENCHMARK_TEMPLATE(BM_SmallLifetime, SmallInlineMap, SmallInlineMapAllocator);
+BENCHMARK_TEMPLATE(BM_SmallLifetime, StdMyList, std::allocator<int>);
+BENCHMARK_TEMPLATE(BM_SmallLifetime, SmallPoolMyList, SmallPoolListAllocator);
+BENCHMARK_TEMPLATE(BM_SmallLifetime, SmallInlineMyList,
+                   SmallInlineListAllocator);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,149 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "allocator.hpp"
+#include "concurrent_allocator.hpp"
+#include "unidir_list-type_container.hpp"
+
+// Масштабирование по числу потоков: каждый поток строит и разрушает свой
+// контейнер, узлы берутся из общего (для аллокатора) пула.
+
+namespace {
+
+constexpr std::size_t POOL_SIZE = 1024;
+constexpr int ELEMENTS_NUMBER = 1000;
+
+using ConcurrentIntAllocator = ConcurrentFixedAllocator<int, POOL_SIZE>;
+using ConcurrentMapAllocator =
+    ConcurrentFixedAllocator<std::pair<const int, int>, POOL_SIZE>;
+
+// FixedAllocator под мьютексом — базовая линия для сравнения.
+// Счётчик ссылок арены FixedAllocator не атомарный, поэтому копии
+// тоже создаются и уничтожаются под мьютексом.
+template <typename T>
+class LockedFixedAllocator {
+public:
+    using value_type = T;
+    using propagate_on_container_move_assignment = std::true_type;
+    using is_always_equal = std::false_type;
+
+    template <class U>
+    struct rebind {
+        using other = LockedFixedAllocator<U>;
+    };
+
+    LockedFixedAllocator()
+        : mutex{std::make_shared<std::mutex>()},
+          allocator{std::make_unique<Pool>()} {
+    }
+    LockedFixedAllocator(const LockedFixedAllocator& other)
+        : LockedFixedAllocator(other, 0) {
+    }
+    template <class U>
+    LockedFixedAllocator(const LockedFixedAllocator<U>& other)
+        : LockedFixedAllocator(other, 0) {
+    }
+    LockedFixedAllocator& operator=(const LockedFixedAllocator&) = delete;
+    ~LockedFixedAllocator() {
+        const std::lock_guard<std::mutex> lock{*mutex};
+        allocator.reset();
+    }
+
+    T* allocate(std::size_t count) {
+        const std::lock_guard<std::mutex> lock{*mutex};
+        return allocator->allocate(count);
+    }
+    void deallocate(T* ptr, std::size_t count) noexcept {
+        const std::lock_guard<std::mutex> lock{*mutex};
+        allocator->deallocate(ptr, count);
+    }
+
+    template <typename U>
+    bool operator==(const LockedFixedAllocator<U>& other) const noexcept {
+        return mutex == other.mutex;
+    }
+
+    template <typename U>
+    friend class LockedFixedAllocator;
+private:
+    using Pool = FixedAllocator<T, POOL_SIZE, GrowthPolicy::Geometric>;
+
+    template <class U>
+    LockedFixedAllocator(const LockedFixedAllocator<U>& other, int)
+        : mutex{other.mutex} {
+        const std::lock_guard<std::mutex> lock{*mutex};
+        allocator = std::make_unique<Pool>(*other.allocator);
+    }
+
+    std::shared_ptr<std::mutex> mutex;
+    std::unique_ptr<Pool> allocator;
+};
+
+template <typename Allocator>
+Allocator& sharedAllocator() {
+    static Allocator allocator;
+    return allocator;
+}
+
+template <typename Allocator>
+void BM_ListFillClear(benchmark::State& state) {
+    const Allocator allocator = sharedAllocator<Allocator>();
+    for (auto _ : state) {
+        MyUniDirListTypeContainer<int, Allocator> list{allocator};
+        for (int i = 0; i < ELEMENTS_NUMBER; ++i) {
+            list.push_back(i);
+        }
+        benchmark::DoNotOptimize(list.size());
+    }
+    state.SetItemsProcessed(state.iterations() * ELEMENTS_NUMBER);
+}
+
+template <typename Allocator>
+void BM_MapInsertErase(benchmark::State& state) {
+    const Allocator allocator = sharedAllocator<Allocator>();
+    for (auto _ : state) {
+        std::map<int, int, std::less<int>, Allocator> map{allocator};
+        for (int i = 0; i < ELEMENTS_NUMBER; ++i) {
+            map.emplace(i, i);
+        }
+        for (int i = 0; i < ELEMENTS_NUMBER; i += 2) {
+            map.erase(i);
+        }
+        benchmark::DoNotOptimize(map.size());
+    }
+    state.SetItemsProcessed(state.iterations() * ELEMENTS_NUMBER);
+}
+
+const int MAX_THREADS =
+    static_cast<int>(std::max(1U, std::thread::hardware_concurrency()));
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_ListFillClear, std::allocator<int>)
+    ->ThreadRange(1, MAX_THREADS)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ListFillClear, LockedFixedAllocator<int>)
+    ->ThreadRange(1, MAX_THREADS)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ListFillClear, ConcurrentIntAllocator)
+    ->ThreadRange(1, MAX_THREADS)
+    ->UseRealTime();
+
+BENCHMARK_TEMPLATE(BM_MapInsertErase, std::allocator<std::pair<const int, int>>)
+    ->ThreadRange(1, MAX_THREADS)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_MapInsertErase,
+                   LockedFixedAllocator<std::pair<const int, int>>)
+    ->ThreadRange(1, MAX_THREADS)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_MapInsertErase, ConcurrentMapAllocator)
+    ->ThreadRange(1, MAX_THREADS)
+    ->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,153 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "allocator.hpp"
+#include "concurrent_allocator.hpp"
+#include "concurrent_queue-type_container.hpp"
+#include "unidir_list-type_container.hpp"
+
+// Передача элементов между потоками: P производителей, C потребителей
+// (MPSC при C = 1). Lock-free MyConcurrentQueueTypeContainer против
+// MyUniDirListTypeContainer под мьютексом, узлы — из кучи или из пула.
+// Элемент — момент push по steady_clock: потребитель считает задержку
+// до try_pop, выводятся пропускная способность, средняя задержка и p99.
+
+namespace {
+
+constexpr std::size_t POOL_SIZE = 1024;
+constexpr std::int64_t ITEMS = 100'000;
+
+using Stamp = std::int64_t;
+
+// Базовая линия: список под мьютексом, очередь — push_back и erase(0)
+template <typename Allocator>
+class LockedListQueue {
+public:
+    void push(Stamp value) {
+        const std::lock_guard<std::mutex> lock{m_mutex};
+        m_list.push_back(value);
+    }
+
+    bool try_pop(Stamp& value) {
+        const std::lock_guard<std::mutex> lock{m_mutex};
+        if (m_list.empty()) {
+            return false;
+        }
+        value = *m_list.begin();
+        m_list.erase(0);
+        return true;
+    }
+private:
+    std::mutex m_mutex;
+    MyUniDirListTypeContainer<Stamp, Allocator> m_list;
+};
+
+using LockedStdQueue = LockedListQueue<std::allocator<Stamp>>;
+using LockedPoolQueue =
+    LockedListQueue<FixedAllocator<Stamp, POOL_SIZE, GrowthPolicy::Geometric>>;
+using LockFreeStdQueue = MyConcurrentQueueTypeContainer<Stamp>;
+using LockFreePoolQueue =
+    MyConcurrentQueueTypeContainer<Stamp,
+                                   ConcurrentFixedAllocator<Stamp, POOL_SIZE>>;
+
+Stamp now() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+// range(0) производителей, range(1) потребителей; очередь и потоки
+// создаются заново на каждой итерации, время — от старта до последнего
+// извлечённого элемента
+template <typename Queue>
+void BM_ProducerConsumer(benchmark::State& state) {
+    const auto producers = static_cast<std::size_t>(state.range(0));
+    const auto consumers = static_cast<std::size_t>(state.range(1));
+    const auto per_producer = ITEMS / state.range(0);
+    const auto total = per_producer * state.range(0);
+    std::vector<Stamp> latencies;
+    for (auto _ : state) {
+        Queue queue;
+        std::atomic<bool> start{false};
+        std::atomic<std::int64_t> consumed{0};
+        std::vector<std::vector<Stamp>> delays(consumers);
+        std::vector<std::thread> threads;
+        for (std::size_t p = 0; p < producers; ++p) {
+            threads.emplace_back([&] {
+                while (!start.load(std::memory_order_acquire)) {
+                    std::this_thread::yield();
+                }
+                for (std::int64_t i = 0; i < per_producer; ++i) {
+                    queue.push(now());
+                }
+            });
+        }
+        for (std::size_t c = 0; c < consumers; ++c) {
+            threads.emplace_back([&, c] {
+                auto& delay = delays[c];
+                delay.reserve(static_cast<std::size_t>(total));
+                Stamp stamp = 0;
+                while (consumed.load(std::memory_order_relaxed) < total) {
+                    if (queue.try_pop(stamp)) {
+                        delay.push_back(now() - stamp);
+                        consumed.fetch_add(1, std::memory_order_relaxed);
+                    } else {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+        const auto begin = std::chrono::steady_clock::now();
+        start.store(true, std::memory_order_release);
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        state.SetIterationTime(std::chrono::duration<double>(
+                                   std::chrono::steady_clock::now() - begin)
+                                   .count());
+        for (const auto& delay : delays) {
+            latencies.insert(latencies.end(), delay.begin(), delay.end());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * total);
+    if (!latencies.empty()) {
+        double sum = 0;
+        for (const Stamp delay : latencies) {
+            sum += static_cast<double>(delay);
+        }
+        const auto p99 = latencies.begin() +
+                         static_cast<std::ptrdiff_t>(latencies.size() * 99 /
+                                                     100);
+        std::nth_element(latencies.begin(), p99, latencies.end());
+        state.counters["latency_ns"] =
+            sum / static_cast<double>(latencies.size());
+        state.counters["p99_ns"] = static_cast<double>(*p99);
+    }
+}
+
+}  // namespace
+
+#define QUEUE_BENCHMARK(queue)                                    \
+    BENCHMARK_TEMPLATE(BM_ProducerConsumer, queue)                \
+        ->ArgNames({"producers", "consumers"})                    \
+        ->Args({1, 1})                                            \
+        ->Args({4, 1})                                            \
+        ->Args({2, 2})                                            \
+        ->Args({4, 4})                                            \
+        ->UseManualTime()                                         \
+        ->Unit(benchmark::kMillisecond)
+
+QUEUE_BENCHMARK(LockedStdQueue);
+QUEUE_BENCHMARK(LockedPoolQueue);
+QUEUE_BENCHMARK(LockFreeStdQueue);
+QUEUE_BENCHMARK(LockFreePoolQueue);
+
+BENCHMARK_MAIN();
@@ -1,11 +1,84 @@
 #pragma once
 
 #include <cstddef>
+#include <limits>
 #include <new>
+#include <ostream>
 #include <stdexcept>
+#include <type_traits>
+#include <utility>
 
-template <typename T, std::size_t N>
+#include "slot_pool.hpp"
+
+// Арена, разделяемая копиями аллокатора и его rebind-версиями.
+// Владеет пулами слотов (по одному на размер/выравнивание узла),
+// время жизни определяется счётчиком ссылок.
+class FixedPoolArena {
+public:
+    FixedPoolArena(std::size_t chunk_slots, GrowthPolicy growth,
+                   ChunkBacking backing = ChunkBacking::Heap) noexcept
+        : m_chunk_slots{chunk_slots}, m_growth{growth}, m_backing{backing} {
+    }
+    FixedPoolArena(const FixedPoolArena&) = delete;
+    FixedPoolArena& operator=(const FixedPoolArena&) = delete;
+
+    ~FixedPoolArena() {
+        while (m_pools != nullptr) {
+            PoolNode* next = m_pools->next;
+            delete m_pools;
+            m_pools = next;
+        }
+    }
+
+    // Найти (или создать) пул для слотов данного размера/выравнивания
+    SlotPool* acquire(std::size_t slot_size, std::size_t slot_align) {
+        for (PoolNode* node = m_pools; node != nullptr; node = node->next) {
+            if (node->pool.serves(slot_size, slot_align)) {
+                return &node->pool;
+            }
+        }
+        m_pools = new PoolNode{SlotPool{slot_size, slot_align, m_chunk_slots,
+                                        m_growth, m_backing},
+                               m_pools};
+        return &m_pools->pool;
+    }
+
+    // Вывести статистику всех пулов арены
+    void dumpStats(std::ostream& os) const {
+        for (const PoolNode* node = m_pools; node != nullptr;
+             node = node->next) {
+            os << node->pool.stats() << "\n";
+        }
+    }
+
+    void retain() noexcept {
+        ++m_ref_count;
+    }
+
+    // true — ссылок больше нет, арену нужно удалить
+    bool release() noexcept {
+        return --m_ref_count == 0;
+    }
+private:
+    struct PoolNode {
+        SlotPool pool;
+        PoolNode* next;
+    };
+
+    std::size_t m_chunk_slots;
+    GrowthPolicy m_growth;
+    ChunkBacking m_backing;
+    PoolNode* m_pools{nullptr};
+    std::size_t m_ref_count{1};
+};
+
+// Backing — источник памяти чанков: куча или огромные страницы
+// (для пулов из миллионов узлов, где обход упирается в промахи TLB)
+template <typename T, std::size_t N,
+          GrowthPolicy Growth = GrowthPolicy::Fixed,
+          ChunkBacking Backing = ChunkBacking::Heap>
 class FixedAllocator {
+    static_assert(N > 0, "FixedAllocator: N must be greater than zero");
 public:
     using value_type = T;
     using pointer = T*;              // (deprecated in C++17)(removed in C++20)
@@ -22,25 +95,59 @@ public:
 
     using is_always_equal = std::false_type;
 
+    // Участок из allocate(count) можно возвращать по одному слоту:
+    // контейнер может выделить сразу все узлы одним запросом
+    using is_run_splittable = std::true_type;
+
+    static constexpr GrowthPolicy growth_policy = Growth;
+    static constexpr ChunkBacking chunk_backing = Backing;
+
     // rebind для STL-совместимости
     template <class U>
     struct rebind {
-        using other = FixedAllocator<U, N>;
+        using other = FixedAllocator<U, N, Growth, Backing>;
         using value_type = U;  // rebind меняет value_type
     };
 
     // Конструкторы/деструктор
-    FixedAllocator() noexcept = default;
-    FixedAllocator(const FixedAllocator&) noexcept = default;
+    // Сконструированный по умолчанию аллокатор сразу получает свою арену
+    // (одно небольшое выделение без пулов): копии и rebind-версии обязаны
+    // разделять её и при этом не бросать исключений и не менять источник.
+    // Если памяти на арену нет, аллокатор остаётся без неё и allocate
+    // бросает std::bad_alloc — как и при нехватке памяти под чанк
+    FixedAllocator() noexcept
+        : arena{new (std::nothrow) FixedPoolArena{N, Growth, Backing}} {
+    }
+    FixedAllocator(const FixedAllocator& other) noexcept
+        : arena{other.arena}, pool{other.pool} {
+        retainArena();
+    }
     template <class U>
-    FixedAllocator(const FixedAllocator<U, N>&) noexcept {
+    FixedAllocator(const FixedAllocator<U, N, Growth, Backing>& other) noexcept
+        : arena{other.arena} {
+        retainArena();
     }
 
-    ~FixedAllocator() {
-        // Освобождаем память при уничтожении аллокатора
-        if (memory_block) {
-            ::operator delete(memory_block);
+    auto operator=(const FixedAllocator& other) noexcept -> FixedAllocator& {
+        if (arena != other.arena) {
+            if (other.arena != nullptr) {
+                other.arena->retain();
+            }
+            releaseArena();
+            arena = other.arena;
+            pool = other.pool;
         }
+        return *this;
+    }
+
+    ~FixedAllocator() {
+        releaseArena();
+    }
+
+    // Копия контейнера получает собственный пул, а не делит заполненный
+    [[nodiscard]]
+    auto select_on_container_copy_construction() const -> FixedAllocator {
+        return FixedAllocator{};
     }
 
     // Выделение памяти
@@ -49,58 +156,21 @@ public:
         if (count == 0) {
             return nullptr;
         }
-        if (count != 1) {  // аллокатор выделяет только по одному элементу
+        if (count > max_size()) {
             throw std::bad_alloc();
         }
-
-        if (!memory_block) {
-            // Выделить единый блок на N элементов c выравниванием памяти
-            memory_block = reinterpret_cast<pointer>(::operator new(
-                N * sizeof(value_type),
-                static_cast<std::align_val_t>(alignof(value_type))));
-
-            allocated_count = 0;
-
-            // Создать индексный free‑list
-            // next_index[i] = i+1, последний = -1
-            for (size_type i = 0; i + 1 < N; ++i) {
-                next_index[i] = static_cast<int>(i + 1);
-            }
-            next_index[N - 1] = -1;  // конец списка
-            free_head = 0;  // первый свободный индекс
-        }
-
-        // Проверка свободных слотов
-        if (free_head == -1) {
-            throw std::bad_alloc();  // свободных слотов нет
-        }
-
-        // Выделение слота по индексу
-        const int index = free_head;
-        free_head = next_index[index];  // сдвиг головы списка
-
-        ++allocated_count;
-
-        return memory_block + index;
+        // count > 1 — непрерывный участок из пула (std::vector, std::deque)
+        return static_cast<pointer>(slotPool()->allocate(count));
     }
 
-    // Память освобождается только в деструкторе
+    // Память освобождается только в деструкторе арены
     // слот вернуть во free‑list
     void deallocate(pointer ptr, size_type count) noexcept {
         if (!ptr || count == 0) {
             return;
         }
-
-        // вычисление индекса слота
-        const size_type index = static_cast<size_type>(ptr - memory_block);
-
-        // возврат индекса в начало списка свободных
-        next_index[index] = free_head;
-        free_head = static_cast<int>(index);
-
-        if (allocated_count > 0) {
-            --allocated_count;
-        }
+        // ptr выделен этим или равным аллокатором: пул в арене уже есть
+        slotPool()->deallocate(ptr, count);
     }
 
     // Конструктор/деструктор
@@ -118,39 +188,80 @@ public:
     // максимальное число объектов типа T, которые может разместить аллокатор
     [[nodiscard]]
     auto max_size() const noexcept -> size_type {
-        return N;
+        if constexpr (Growth == GrowthPolicy::Fixed) {
+            return N;
+        } else {
+            return std::numeric_limits<size_type>::max() / sizeof(value_type);
+        }
     }
 
-    template <typename U, std::size_t M>
-    friend class FixedAllocator;
+    // Статистика пула value_type (см. SlotPoolStats, ALLOCATOR_STATS)
+    [[nodiscard]]
+    auto stats() const -> SlotPoolStats {
+        return pool != nullptr ? pool->stats() : SlotPoolStats{};
+    }
+
+    // Вывести статистику всей общей арены
+    void dumpStats(std::ostream& os) const {
+        if (arena != nullptr) {
+            arena->dumpStats(os);
+        }
+    }
 
-    template <typename U, std::size_t M>
-    friend auto operator==(const FixedAllocator&,
-                           const FixedAllocator<U, M>&) noexcept -> bool;
+    template <typename U, std::size_t M, GrowthPolicy G, ChunkBacking B>
+    friend class FixedAllocator;
 
-    template <typename U, std::size_t M>
-    friend auto operator!=(const FixedAllocator&,
-                           const FixedAllocator<U, M>&) noexcept -> bool;
+    template <typename U, std::size_t M, GrowthPolicy G, ChunkBacking B,
+              typename V, std::size_t K, GrowthPolicy H, ChunkBacking C>
+    friend auto operator==(const FixedAllocator<U, M, G, B>&,
+                           const FixedAllocator<V, K, H, C>&) noexcept
+        -> bool;
 private:
-    pointer memory_block = nullptr;  // Единый блок памяти
-    size_type allocated_count{0};    // Сколько уже выделено
-
-    // Индексный free‑list:
-    // next_index[i] = индекс следующего свободного слота
-    // next_index[i] = i+1, последний = -1
-    int next_index[N]{};
-    // Голова списка индексов свободных слотов
-    int free_head{-1};
+    // Пул слотов для value_type в общей арене (создаётся при первом вызове)
+    auto slotPool() -> SlotPool* {
+        if (pool == nullptr) {
+            if (arena == nullptr) {
+                throw std::bad_alloc();  // арену не удалось создать
+            }
+            pool = arena->acquire(sizeof(value_type), alignof(value_type));
+        }
+        return pool;
+    }
+
+    void retainArena() noexcept {
+        if (arena != nullptr) {
+            arena->retain();
+        }
+    }
+
+    void releaseArena() noexcept {
+        if (arena != nullptr && arena->release()) {
+            delete arena;
+        }
+    }
+
+    // Общая арена (с подсчётом ссылок), nullptr — не хватило памяти
+    FixedPoolArena* arena;
+    SlotPool* pool = nullptr;   // Пул для value_type внутри арены
 };
 
-template <typename T, std::size_t N, typename U, std::size_t M>
-auto operator==(const FixedAllocator<T, N>&,
-                const FixedAllocator<U, M>&) noexcept -> bool {
-    return N == M;
+// Аллокаторы равны, если разделяют одну арену (аллокаторы без арены
+// ничего не выделяют и равны между собой)
+template <typename T, std::size_t N, GrowthPolicy G1, ChunkBacking B1,
+          typename U, std::size_t M, GrowthPolicy G2, ChunkBacking B2>
+auto operator==(
+    [[maybe_unused]] const FixedAllocator<T, N, G1, B1>& lhs,
+    [[maybe_unused]] const FixedAllocator<U, M, G2, B2>& rhs) noexcept -> bool {
+    if constexpr (N == M && G1 == G2 && B1 == B2) {
+        return lhs.arena == rhs.arena;
+    } else {
+        return false;
+    }
 }
 
-template <typename T, std::size_t N, typename U, std::size_t M>
-auto operator!=(const FixedAllocator<T, N>& lhs,
-                const FixedAllocator<U, M>& rhs) noexcept -> bool {
+template <typename T, std::size_t N, GrowthPolicy G1, ChunkBacking B1,
+          typename U, std::size_t M, GrowthPolicy G2, ChunkBacking B2>
+auto operator!=(const FixedAllocator<T, N, G1, B1>& lhs,
+                const FixedAllocator<U, M, G2, B2>& rhs) noexcept -> bool {
     return !(lhs == rhs);
 }
@@ -0,0 +1,1327 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+// Узлы B+-дерева выравниваются по строке кэша и занимают целое число строк
+constexpr std::size_t BTREE_CACHE_LINE = 64;
+
+// Общий заголовок узла: тип узла и заполненность
+struct MyBTreeNodeBase {
+    std::uint16_t m_count{0};  // элементов в листе / потомков во внутреннем
+    bool m_leaf{true};
+};
+
+// Смещение первого поля наследника после заголовка
+constexpr std::size_t BTREE_NODE_HEADER =
+    (sizeof(MyBTreeNodeBase) + alignof(void*) - 1) / alignof(void*) *
+    alignof(void*);
+
+// Лист: элементы по возрастанию ключа, соседние листья связаны в
+// двусвязный список для обхода. Ёмкость подбирается так, чтобы лист
+// занимал NodeBytes, но не меньше 4 элементов
+template <typename Value, std::size_t NodeBytes>
+struct alignas(BTREE_CACHE_LINE) MyBTreeLeaf : MyBTreeNodeBase {
+    static constexpr std::size_t capacity = std::max<std::size_t>(
+        4, (NodeBytes - BTREE_NODE_HEADER - 2 * sizeof(void*)) / sizeof(Value));
+
+    // Память элементов не инициализируется: элементы создаются на месте
+    MyBTreeLeaf() noexcept {
+    }
+
+    Value* values() noexcept {
+        return std::launder(reinterpret_cast<Value*>(m_storage));
+    }
+    const Value* values() const noexcept {
+        return std::launder(reinterpret_cast<const Value*>(m_storage));
+    }
+
+    MyBTreeLeaf* m_prev{nullptr};
+    MyBTreeLeaf* m_next{nullptr};
+    alignas(Value) unsigned char m_storage[capacity * sizeof(Value)];
+};
+
+// Внутренний узел: m_count потомков и m_count - 1 разделителей.
+// Разделитель i — наименьший ключ поддерева i + 1 на момент разбиения:
+// ключи потомка i меньше него, ключи потомка i + 1 — не меньше
+template <typename Key, std::size_t NodeBytes>
+struct alignas(BTREE_CACHE_LINE) MyBTreeInternal : MyBTreeNodeBase {
+    static constexpr std::size_t capacity = std::max<std::size_t>(
+        4, (NodeBytes - BTREE_NODE_HEADER + sizeof(Key)) /
+               (sizeof(Key) + sizeof(void*)));
+
+    MyBTreeInternal() noexcept {
+    }
+
+    Key* keys() noexcept {
+        return std::launder(reinterpret_cast<Key*>(m_storage));
+    }
+    const Key* keys() const noexcept {
+        return std::launder(reinterpret_cast<const Key*>(m_storage));
+    }
+
+    MyBTreeNodeBase* m_children[capacity];
+    alignas(Key) unsigned char m_storage[(capacity - 1) * sizeof(Key)];
+};
+
+// Упорядоченный ассоциативный контейнер на B+-дереве — замена std::map
+// там, где важны поиск и обход: в узле размером NodeBytes (по умолчанию
+// 4 строки кэша) десятки ключей, поэтому высота дерева в несколько раз
+// меньше, чем у красно-чёрного, а обход идёт по плотным листьям.
+// Узлы (листья и внутренние — разные типы) выделяются аллокатором
+// поштучно, так что FixedAllocator раздаёт их из пулов.
+// Разбиение при вставке и выравнивание при удалении выполняются на
+// спуске от корня, без возврата вверх. Вставка в конец заполняет узлы
+// целиком, остальные разбиения делят узел пополам.
+// В отличие от std::map, вставка и удаление делают недействительными все
+// итераторы и ссылки на элементы: элементы перемещаются между узлами.
+// Перемещение элементов и ключей не должно бросать исключений.
+template <typename Key, typename T, typename Compare = std::less<Key>,
+          typename Allocator = std::allocator<std::pair<const Key, T>>,
+          std::size_t NodeBytes = 4 * BTREE_CACHE_LINE>
+class MyBTreeMapTypeContainer {
+    static_assert(NodeBytes % BTREE_CACHE_LINE == 0 && NodeBytes > 0,
+                  "MyBTreeMapTypeContainer: NodeBytes must be a positive "
+                  "multiple of the cache line");
+public:
+    using key_type = Key;
+    using mapped_type = T;
+    using value_type = std::pair<const Key, T>;
+    using key_compare = Compare;
+    using allocator_type = Allocator;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+
+    using leaf_type = MyBTreeLeaf<value_type, NodeBytes>;
+    using internal_type = MyBTreeInternal<Key, NodeBytes>;
+    using leaf_allocator_type = typename std::allocator_traits<
+        allocator_type>::template rebind_alloc<leaf_type>;
+    using leaf_allocator_traits = std::allocator_traits<leaf_allocator_type>;
+    using internal_allocator_type = typename std::allocator_traits<
+        allocator_type>::template rebind_alloc<internal_type>;
+    using internal_allocator_traits =
+        std::allocator_traits<internal_allocator_type>;
+
+    static constexpr size_type leaf_capacity = leaf_type::capacity;
+    static constexpr size_type internal_capacity = internal_type::capacity;
+    static_assert(leaf_capacity <= std::numeric_limits<std::uint16_t>::max(),
+                  "MyBTreeMapTypeContainer: NodeBytes is too large");
+
+    // Итератор: лист и позиция в нём (BidirectionalIterator).
+    // end() — позиция за последним элементом последнего листа
+    class iterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = MyBTreeMapTypeContainer::value_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = value_type*;
+        using reference = value_type&;
+
+        iterator() noexcept = default;
+        iterator(leaf_type* leaf, size_type index) noexcept
+            : m_leaf(leaf), m_index(index) {
+        }
+        reference operator*() const noexcept {
+            return m_leaf->values()[m_index];
+        }
+        pointer operator->() const noexcept {
+            return m_leaf->values() + m_index;
+        }
+        iterator& operator++() noexcept {
+            if (++m_index == m_leaf->m_count && m_leaf->m_next != nullptr) {
+                m_leaf = m_leaf->m_next;
+                m_index = 0;
+            }
+            return *this;
+        }
+        iterator operator++(int) noexcept {
+            iterator temp = *this;
+            ++*this;
+            return temp;
+        }
+        iterator& operator--() noexcept {
+            if (m_index == 0) {
+                m_leaf = m_leaf->m_prev;
+                m_index = m_leaf->m_count;
+            }
+            --m_index;
+            return *this;
+        }
+        iterator operator--(int) noexcept {
+            iterator temp = *this;
+            --*this;
+            return temp;
+        }
+        bool operator==(const iterator& other) const noexcept {
+            return m_leaf == other.m_leaf && m_index == other.m_index;
+        }
+        bool operator!=(const iterator& other) const noexcept {
+            return !(*this == other);
+        }
+    private:
+        friend class MyBTreeMapTypeContainer;
+        friend class const_iterator;
+        leaf_type* m_leaf{nullptr};
+        size_type m_index{0};
+    };
+
+    // Константный итератор
+    class const_iterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = MyBTreeMapTypeContainer::value_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const value_type*;
+        using reference = const value_type&;
+
+        const_iterator() noexcept = default;
+        const_iterator(const leaf_type* leaf, size_type index) noexcept
+            : m_leaf(leaf), m_index(index) {
+        }
+        const_iterator(const iterator& it) noexcept
+            : m_leaf(it.m_leaf), m_index(it.m_index) {
+        }
+        reference operator*() const noexcept {
+            return m_leaf->values()[m_index];
+        }
+        pointer operator->() const noexcept {
+            return m_leaf->values() + m_index;
+        }
+        const_iterator& operator++() noexcept {
+            if (++m_index == m_leaf->m_count && m_leaf->m_next != nullptr) {
+                m_leaf = m_leaf->m_next;
+                m_index = 0;
+            }
+            return *this;
+        }
+        const_iterator operator++(int) noexcept {
+            const_iterator temp = *this;
+            ++*this;
+            return temp;
+        }
+        const_iterator& operator--() noexcept {
+            if (m_index == 0) {
+                m_leaf = m_leaf->m_prev;
+                m_index = m_leaf->m_count;
+            }
+            --m_index;
+            return *this;
+        }
+        const_iterator operator--(int) noexcept {
+            const_iterator temp = *this;
+            --*this;
+            return temp;
+        }
+        bool operator==(const const_iterator& other) const noexcept {
+            return m_leaf == other.m_leaf && m_index == other.m_index;
+        }
+        bool operator!=(const const_iterator& other) const noexcept {
+            return !(*this == other);
+        }
+    private:
+        friend class MyBTreeMapTypeContainer;
+        const leaf_type* m_leaf{nullptr};
+        size_type m_index{0};
+    };
+
+    MyBTreeMapTypeContainer() = default;
+    explicit MyBTreeMapTypeContainer(const Compare& comp,
+                                     const Allocator& alloc = Allocator());
+    explicit MyBTreeMapTypeContainer(const Allocator& alloc);
+    template <std::input_iterator InputIt>
+    MyBTreeMapTypeContainer(InputIt first, InputIt last,
+                            const Compare& comp = Compare(),
+                            const Allocator& alloc = Allocator());
+    MyBTreeMapTypeContainer(std::initializer_list<value_type> init,
+                            const Compare& comp = Compare(),
+                            const Allocator& alloc = Allocator());
+    MyBTreeMapTypeContainer(const MyBTreeMapTypeContainer& other);
+    MyBTreeMapTypeContainer(MyBTreeMapTypeContainer&& other) noexcept;
+    ~MyBTreeMapTypeContainer();
+    MyBTreeMapTypeContainer& operator=(const MyBTreeMapTypeContainer& other);
+    MyBTreeMapTypeContainer& operator=(MyBTreeMapTypeContainer&& other);
+    MyBTreeMapTypeContainer& operator=(std::initializer_list<value_type> init);
+
+    iterator begin() noexcept {
+        return iterator(m_first_leaf, 0);
+    }
+    iterator end() noexcept {
+        return iterator(m_last_leaf, m_last_leaf ? m_last_leaf->m_count : 0);
+    }
+    const_iterator begin() const noexcept {
+        return cbegin();
+    }
+    const_iterator end() const noexcept {
+        return cend();
+    }
+    const_iterator cbegin() const noexcept {
+        return const_iterator(m_first_leaf, 0);
+    }
+    const_iterator cend() const noexcept {
+        return const_iterator(m_last_leaf,
+                              m_last_leaf ? m_last_leaf->m_count : 0);
+    }
+
+    bool empty() const noexcept;
+    size_type size() const noexcept;
+    // Число уровней: 0 — пустое дерево, 1 — только корневой лист
+    size_type height() const noexcept;
+    void clear() noexcept;
+
+    T& operator[](const Key& key);
+    T& operator[](Key&& key);
+    // При отсутствии ключа — std::out_of_range
+    T& at(const Key& key);
+    const T& at(const Key& key) const;
+
+    std::pair<iterator, bool> insert(const value_type& value);
+    std::pair<iterator, bool> insert(value_type&& value);
+    template <std::input_iterator InputIt>
+    void insert(InputIt first, InputIt last);
+    void insert(std::initializer_list<value_type> init);
+    template <typename... Args>
+    std::pair<iterator, bool> emplace(Args&&... args);
+    template <typename... Args>
+    std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args);
+    template <typename... Args>
+    std::pair<iterator, bool> try_emplace(Key&& key, Args&&... args);
+
+    // Удаление по позиции возвращает позицию следующего элемента (ищется
+    // заново по ключу: узлы могли слиться)
+    iterator erase(iterator pos);
+    iterator erase(const_iterator pos);
+    size_type erase(const Key& key);
+    void swap(MyBTreeMapTypeContainer& other) noexcept;
+
+    iterator find(const Key& key);
+    const_iterator find(const Key& key) const;
+    bool contains(const Key& key) const;
+    size_type count(const Key& key) const;
+    iterator lower_bound(const Key& key);
+    const_iterator lower_bound(const Key& key) const;
+    iterator upper_bound(const Key& key);
+    const_iterator upper_bound(const Key& key) const;
+
+    // Аллокатор, общий для листьев и внутренних узлов
+    Allocator get_allocator() const;
+    key_compare key_comp() const;
+private:
+    MyBTreeNodeBase* m_root{nullptr};
+    leaf_type* m_first_leaf{nullptr};
+    leaf_type* m_last_leaf{nullptr};
+    size_type m_size{0};
+    size_type m_height{0};
+    Compare m_compare{};
+    leaf_allocator_type m_leaf_allocator{};
+    // rebind-копия листового: оба вида узлов берутся из одной арены
+    internal_allocator_type m_internal_allocator{m_leaf_allocator};
+
+    // Минимальная заполненность некорневого узла; узел, заполненный не
+    // больше минимума, перед спуском в него при удалении выравнивается
+    static constexpr size_type leaf_min = leaf_capacity / 2;
+    static constexpr size_type internal_min = internal_capacity / 2;
+
+    leaf_type* createLeaf();
+    internal_type* createInternal();
+    void destroyLeaf(leaf_type* leaf) noexcept;
+    void destroyInternal(internal_type* internal) noexcept;
+    void destroySubtree(MyBTreeNodeBase* node) noexcept;
+
+    // Поиск: номер потомка для ключа, позиции в листе и лист с ключом
+    size_type childIndex(const internal_type* internal, const Key& key) const;
+    size_type leafLowerBound(const leaf_type* leaf, const Key& key) const;
+    size_type leafUpperBound(const leaf_type* leaf, const Key& key) const;
+    leaf_type* findLeaf(const Key& key) const;
+    // Позиция (лист, индекс); индекс за концом листа переносится в
+    // начало следующего
+    iterator normalize(leaf_type* leaf, size_type index) const noexcept;
+
+    // Вставка нового ключа (наличие проверено), construct создаёт элемент
+    // по переданному адресу
+    template <typename Construct>
+    iterator insertNew(const Key& key, Construct construct);
+    // Разбиение заполненного потомка index; append — ключ вставляется
+    // правее всех ключей дерева
+    void splitChild(internal_type* parent, size_type index, bool append);
+    // Вставка разделителя и правого потомка после потомка index
+    void insertChild(internal_type* parent, size_type index, const Key& key,
+                     MyBTreeNodeBase* child);
+    // Удаление существующего ключа
+    void eraseExisting(const Key& key);
+    // Пополнение потомка index за счёт соседа или слияние с ним
+    void rebalanceChild(internal_type* parent, size_type index);
+    void mergeLeaves(internal_type* parent, size_type index);
+    void mergeInternals(internal_type* parent, size_type index);
+    // Удаление потомка index + 1 и разделителя index (уже разрушенного)
+    void removeChild(internal_type* parent, size_type index) noexcept;
+    void stealFrom(MyBTreeMapTypeContainer& other) noexcept;
+
+    // Число первых элементов [first, first + count), для которых before
+    // истинно (before — монотонный предикат). Двоичный поиск без
+    // ветвлений: число шагов зависит только от count, выбор половины —
+    // условная пересылка, поэтому внутри узла нет ошибок предсказания
+    template <typename U, typename Predicate>
+    static size_type partitionPoint(const U* first, size_type count,
+                                    Predicate before);
+
+    // Перенос count объектов: конструирование перемещением на новом месте
+    // и разрушение на старом. Forward — для dst < src или разных узлов,
+    // Backward — для сдвига вправо внутри узла
+    template <typename U>
+    static void relocateForward(U* src, size_type count, U* dst) noexcept;
+    template <typename U>
+    static void relocateBackward(U* src, size_type count, U* dst) noexcept;
+};
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+          std::size_t NodeBytes>
+MyBTreeMapTypeContainer<Key, T, Compare, Allocator, NodeBytes>::
+    MyBTreeMapTypeContainer(const Compare& comp, const Allocator& alloc)
+    : m_compare(comp), m_leaf_allocator(alloc) {
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+          std::size_t NodeBytes>
+MyBTreeMapTypeContainer<Key, T, Compare, Allocator, NodeBytes>::
+    MyBTreeMapTypeContainer(const Allocator& alloc)
+    : m_leaf_allocator(alloc) {
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+          std::size_t NodeBytes>
+template <std::input_iterator InputIt>
+MyBTreeMapTypeContainer<Key, T, Compare, Allocator, NodeBytes>::
+    MyBTreeMapTypeContainer(InputIt first, InputIt last, const Compare& comp,
+                            const Allocator& alloc)
+    : MyBTreeMapTypeContainer(comp, alloc) {
+    insert(first, last);
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+          std::size_t NodeBytes>
+MyBTreeMapTypeContainer<Key, T, Compare, Allocator, NodeBytes>::
+    MyBTreeMapTypeContainer(std::initializer_list<value_type> init,
+                            const Compare& comp, const Allocator& alloc)
+    : MyBTreeMapTypeContainer(comp, alloc) {
+    insert(init);
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+          std::size_t NodeBytes>
+MyBTreeMapTypeContainer<Key, T, Compare, Allocator, NodeBytes>::
+    MyBTreeMapTypeContainer(const MyBTreeMapTypeContainer& other)
+    : m_compare(other.m_compare),
+      m_leaf_allocator(
+          leaf_allocator_traits::select_on_container_copy_construction(
+              other.m_leaf_allocator)) {
+    try {
+        // Ключи идут по возрастанию — каждая вставка в конец
+        for (const value_type& value : other) {
+            insertNew(value.first, [&value](value_type* slot) {
+                std::construct_at(slot, value);
+            });
+        }
+    } catch (...) {
+        clear();
+        throw;
+    }
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+          std::size_t NodeBytes>
+MyBTreeMapTypeContainer<Key, T, Compare, Allocator, NodeBytes>::
+    MyBTreeMapTypeContainer(MyBTreeMapTypeContainer&& other) noexcept
+    : m_compare(std::move(other.m_compare)),
+      m_leaf_allocator(std::move(other.m_leaf_allocator)) {
+    stealFrom(other);
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+          std::size_t NodeBytes>
+MyBTreeMapTypeContainer<Key, T, Compare, Allocator,
+                        NodeBytes>::~MyBTreeMapTypeContainer() {
+    clear();
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+          std::size_t NodeBytes>
+MyBTreeMapTypeContainer<Key, T, Compare, Allocator, NodeBytes>&
+MyBTreeMapTypeContainer<Key, T, Compare, Allocator, NodeBytes>::operator=(
+    const MyBTreeMapTypeContainer& other) {
+    if (this == &other) {
+        return *this;
+    }
+    // узлы, выделенные прежним аллокатором, освобождаются им же
+    clear();
+    if constexpr (leaf_allocator_traits::
+                      propagate_on_container_copy_assignment::value) {
+        m_leaf_allocator = other.m_leaf_allocator;
+        m_internal_allocator = internal_allocator_type(m_leaf_allocator);
+    }
+    m_compare = other.m_compare;
+    for (const value_type& value : other) {
+        insertNew(value.first, [&value](value_type* slot) {
+            std::construct_at(slot, value);
+        });
+    }
+    return *this;
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+          std::size_t NodeBytes>
+MyBTreeMapTypeContainer<Key, T, Compare, Allocator, NodeBytes>&
+MyBTreeMapTypeContainer<Key, T, Compare, Allocator, NodeBytes>::operator=(
+    MyBTreeMapTypeContainer&& other) {
+    if (this == &other) {
+        return *this;
+    }
+    clear();
+    m_compare = other.m_compare;
+    if constexpr (!leaf_allocator_traits::
+                      propagate_on_container_move_assignment::value) {
+        // аллокатор не переносится: узлы из чужого ресурса нельзя
+        // забрать — переносим поэлементно
+        if (m_leaf_allocator != other.m_leaf_allocator) {
+            for (value_type& value : other) {
+                insertNew(value.first, [&value](value_type* slot) {
+                    std::construct_at(slot, std::move(value));
+                });
+            }
+            other.clear();
+            return *this;
+        }
+    } else {
+        m_leaf_allocator = std::move(other.m_leaf_allocator);
+        m_internal_allocator = internal_allocator_type(m_leaf_allocator);
+    }
+    stealFrom(other);
+    return *this;
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+          std::size_t NodeBytes>
+MyBTreeMapTypeContainer<Key, T, Compare, Allocator, NodeBytes>&
+MyBTreeMapTypeContainer<Key, T, Compare, Allocator, NodeBytes>::operator=(
+    std::initializer_list<value_type> init) {
+    clear();
+    insert(init);
+    return *this;
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+          std::size_t NodeBytes>
+bool MyBTreeMapTypeContainer<Key, T, Compare, Allocator, NodeBytes>::empty()
+    const noexcept {
+    return m_size == 0;
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+          std::size_t NodeBytes>
+std::size_t
+MyBTreeMapTypeContainer<Key, T, Compare, Allocator, NodeBytes>::size()
+    const noexcept {
+    return m_size;
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+          std::size_t NodeBytes>
+std::size_t
+MyBTreeMapTypeContainer<Key, T, Compare, Allocator, NodeBytes>::height()
+    const noexcept {
+    return m_height;
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+          std::size_t NodeBytes>
+void MyBTreeMapTypeContainer<Key, T, Compare, Allocator,
+                             NodeBytes>::clear() noexcept {
+    if (m_root != nullptr) {
+        destroySubtree(m_root);
+    }
+    m_root = nullptr;
+    m_first_leaf = nullptr;
+    m_last_leaf = nullptr;
+    m_size = 0;
+    m_height = 0;
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+          std::size_t NodeBytes>
+T& MyBTreeMapTypeContainer<Key, T, Compare, Allocator, NodeBytes>::operator[](
+    const Key& key) {
+    return try_emplace(key).first->second;
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+          std::size_t NodeBytes>
+T& MyBTreeMapTypeContainer<Key, T, Compare, Allocator, NodeBytes>::operator[](
+    Key&& key) {
+    return try_emplace(std::move(key)).first->second;
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+          std::size_t NodeBytes>
+T& MyBTreeMapTypeContainer<Key, T, Compare, Allocator, NodeBytes>::at(
+    const Key& key) {
+    const iterator it = find(key);
+    if (it == end()) {
+        throw std::out_of_range("MyBTreeMapTypeContainer::at: no such key");
+    }
+    return it->second;
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+          std::size_t NodeBytes>
+const T& MyBTreeMapTypeContainer<Key, T, Compare, Allocator, NodeBytes>::at(
+    const Key& key) const {
+    const const_iterator it = find(key);
+    if (it == end()) {
+        throw std::out_of_range("MyBTreeMapTypeContainer::at: no such key");
+    }
+    return it->second;
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+          std::size_t NodeBytes>
+std::pair<typename MyBTreeMapTypeContainer<Key, T, Compare, Allocator,
+                                           NodeBytes>::iterator,
+          bool>
+MyBTreeMapTypeContainer<Key, T, Compare, Allocator, NodeBytes>::insert(
+    const value_type& value) {
+    if (const iterator it = find(value.first); it != end()) {
+        return {it, false};
+    }
+    return {insertNew(value.first,
+                      [&value](value_type* slot) {
+                          std::construct_at(slot, value);
+                      }),
+            true};
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+          std::size_t NodeBytes>
+std::pair<typename MyBTreeMapTypeContainer<Key, T, Compare, Allocator,
+                                           NodeBytes>::iterator,
+          bool>
+MyBTreeMapTypeContainer<Key, T, Compare, Allocator, NodeBytes>::insert(
+    value_type&& value) {
+    if (const iterator it = find(value.first); it != end()) {
+        return {it, false};
+    }
+    return {insertNew(value.first,
+                      [&value](value_type* slot) {
+                          std::construct_at(slot, std::move(value));
+                      }),
+            true};
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+          std::size_t NodeBytes>
+template <std::input_iterator InputIt>
+void MyBTreeMapTypeContainer<Key, T, Compare, Allocator, NodeBytes>::insert(
+    InputIt first, InputIt last) {
+    for (; first != last; ++first) {
+        emplace(*first);
+    }
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+          std::size_t NodeBytes>
+void MyBTreeMapTypeContainer<Key, T, Compare, Allocator, NodeBytes>::insert(
+    std::initializer_list<value_type> init) {
+    insert(init.begin(), init.end());
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+          std::size_t NodeBytes>
+template <typename... Args>
+std::pair<typename MyBTreeMapTypeContainer<Key, T, Compare, Allocator,
+                                           NodeBytes>::iterator,
+          bool>
+MyBTreeMapTypeContainer<Key, T, Compare, Allocator, NodeBytes>::emplace(
+    Args&&... args) {
+    // Ключ известен только после создания элемента
+    return insert(value_type(std::forward<Args>(args)...));
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+          std::size_t NodeBytes>
+template <typename... Args>
+std::pair<typename MyBTreeMapTypeContainer<Key, T, Compare, Allocator,
+                                           NodeBytes>::iterator,
+          bool>
+MyBTreeMapTypeContainer<Key, T, Compare, Allocator, NodeBytes>::try_emplace(
+    const Key& key, Args&&... args) {
+    if (const iterator it = find(key); it != end()) {
+        return {it, false};
+    }
+    return {insertNew(key,
+                      [&](value_type* slot) {
+                          std::construct_at(
+                              slot, std::piecewise_construct,
+                              std::forward_as_tuple(key),
+                              std::forward_as_tuple(
+                                  std::forward<Args>(args)...));
+                      }),
+            true};
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+          std::size_t NodeBytes>
+template <typename... Args>
+std::pair<typename MyBTreeMapTypeContainer<Key, T, Compare, Allocator,
+                                           NodeBytes>::iterator,
+          bool>
+MyBTreeMapTypeContainer<Key, T, Compare, Allocator, NodeBytes>::try_emplace(
+    Key&& key, Args&&... args) {
+    if (const iterator it = find(key); it != end()) {
+        return {it, false};
+    }
+    // Разделители копируются из элементов, а не из key, поэтому key
+    // можно переместить в элемент
+    return {insertNew(key,
+                      [&](value_type* slot) {
+                          std::construct_at(
+                              slot, std::piecewise_construct,
+                              std::forward_as_tuple(std::move(key)),
+                              std::forward_as_tuple(
+                                  std::forward<Args>(args)...));
+                      }),
+            true};
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+          std::size_t NodeBytes>
+typename MyBTreeMapTypeContainer<Key, T, Compare, Allocator,
+                                 NodeBytes>::iterator
+MyBTreeMapTypeContainer<Key, T, Compare, Allocator, NodeBytes>::erase(
+    iterator pos) {
+    return erase(const_iterator(pos));
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+          std::size_t NodeBytes>
+typename MyBTreeMapTypeContainer<Key, T, Compare, Allocator,
+                                 NodeBytes>::iterator
+MyBTreeMapTypeContainer<Key, T, Compare, Allocator, NodeBytes>::erase(
+    const_iterator pos) {
+    // Элемент будет разрушен — ключ для поиска следующего копируется
+    const Key key = pos->first;
+    eraseExisting(key);
+    return lower_bound(key);
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+          std::size_t NodeBytes>
+std::size_t
+MyBTreeMapTypeContainer<Key, T, Compare, Allocator, NodeBytes>::erase(
+    const Key& key) {
+    // Проверка без изменения дерева: выравнивание на спуске имеет смысл,
+    // только если ключ действительно удаляется
+    if (!contains(key)) {
+        return 0;
+    }
+    eraseExisting(key);
+    return 1;
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+          std::size_t NodeBytes>
+void MyBTreeMapTypeContainer<Key, T, Compare, Allocator, NodeBytes>::swap(
+    MyBTreeMapTypeContainer& other) noexcept {
+    using std::swap;
+    swap(m_root, other.m_root);
+    swap(m_first_leaf, other.m_first_leaf);
+    swap(m_last_leaf, other.m_last_leaf);
+    swap(m_size, other.m_size);
+    swap(m_height, other.m_height);
+    swap(m_compare, other.m_compare);
+    if constexpr (leaf_allocator_traits::propagate_on_container_swap::value) {
+        swap(m_leaf_allocator, other.m_leaf_allocator);
+        swap(m_internal_allocator, other.m_internal_allocator);
+    }
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+          std::size_t NodeBytes>
+typename MyBTreeMapTypeContainer<Key, T, Compare, Allocator,
+                                 NodeBytes>::iterator
+MyBTreeMapTypeContainer<Key, T, Compare, Allocator, NodeBytes>::find(
+    const Key& key) {
+    if (m_root == nullptr) {
+        return end();
+    }
+    leaf_type* leaf = findLeaf(key);
+    const size_type index = leafLowerBound(leaf, key);
+    if (index == leaf->m_count ||
+        m_compare(key, leaf->values()[index].first)) {
+        return end();
+    }
+    return iterator(leaf, index);
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+          std::size_t NodeBytes>
+typename MyBTreeMapTypeContainer<Key, T, Compare, Allocator,
+                                 NodeBytes>::const_iterator
+MyBTreeMapTypeContainer<Key, T, Compare, Allocator, NodeBytes>::find(
+    const Key& key) const {
+    return const_cast<MyBTreeMapTypeContainer*>(this)->find(key);
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+          std::size_t NodeBytes>
+bool MyBTreeMapTypeContainer<Key, T, Compare, Allocator, NodeBytes>::contains(
+    const Key& key) const {
+    return find(key) != end();
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+          std::size_t NodeBytes>
+std::size_t
+MyBTreeMapTypeContainer<Key, T, Compare, Allocator, NodeBytes>::count(
+    const Key& key) const {
+    return contains(key) ? 1 : 0;
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+          std::size_t NodeBytes>
+typename MyBTreeMapTypeContainer<Key, T, Compare, Allocator,
+                                 NodeBytes>::iterator
+MyBTreeMapTypeContainer<Key, T, Compare, Allocator, NodeBytes>::lower_bound(
+    const Key& key) {
+    if (m_root == nullptr) {
+        return end();
+    }
+    leaf_type* leaf = findLeaf(key);
+    return normalize(leaf, leafLowerBound(leaf, key));
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+          std::size_t NodeBytes>
+typename MyBTreeMapTypeContainer<Key, T, Compare, Allocator,
+                                 NodeBytes>::const_iterator
+MyBTreeMapTypeContainer<Key, T, Compare, Allocator, NodeBytes>::lower_bound(
+    const Key& key) const {
+    return const_cast<MyBTreeMapTypeContainer*>(this)->lower_bound(key);
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+          std::size_t NodeBytes>
+typename MyBTreeMapTypeContainer<Key, T, Compare, Allocator,
+                                 NodeBytes>::iterator
+MyBTreeMapTypeContainer<Key, T, Compare, Allocator, NodeBytes>::upper_bound(
+    const Key& key) {
+    if (m_root == nullptr) {
+        return end();
+    }
+    leaf_type* leaf = findLeaf(key);
+    return normalize(leaf, leafUpperBound(leaf, key));
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+          std::size_t NodeBytes>
+typename MyBTreeMapTypeContainer<Key, T, Compare, Allocator,
+                                 NodeBytes>::const_iterator
+MyBTreeMapTypeContainer<Key, T, Compare, Allocator, NodeBytes>::upper_bound(
+    const Key& key) const {
+    return const_cast<MyBTreeMapTypeContainer*>(this)->upper_bound(key);
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+          std::size_t NodeBytes>
+Allocator
+MyBTreeMapTypeContainer<Key, T, Compare, Allocator, NodeBytes>::get_allocator()
+    const {
+    return Allocator(m_leaf_allocator);
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+          std::size_t NodeBytes>
+Compare
+MyBTreeMapTypeContainer<Key, T, Compare, Allocator, NodeBytes>::key_comp()
+    const {
+    return m_compare;
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+          std::size_t NodeBytes>
+typename MyBTreeMapTypeContainer<Key, T, Compare, Allocator,
+                                 NodeBytes>::leaf_type*
+MyBTreeMapTypeContainer<Key, T, Compare, Allocator, NodeBytes>::createLeaf() {
+    leaf_type* leaf = leaf_allocator_traits::allocate(m_leaf_allocator, 1);
+    leaf_allocator_traits::construct(m_leaf_allocator, leaf);
+    return leaf;
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+          std::size_t NodeBytes>
+typename MyBTreeMapTypeContainer<Key, T, Compare, Allocator,
+                                 NodeBytes>::internal_type*
+MyBTreeMapTypeContainer<Key, T, Compare, Allocator,
+                        NodeBytes>::createInternal() {
+    internal_type* internal =
+        internal_allocator_traits::allocate(m_internal_allocator, 1);
+    internal_allocator_traits::construct(m_internal_allocator, internal);
+    internal->m_leaf = false;
+    return internal;
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+          std::size_t NodeBytes>
+void MyBTreeMapTypeContainer<Key, T, Compare, Allocator,
+                             NodeBytes>::destroyLeaf(leaf_type* leaf) noexcept {
+    std::destroy_n(leaf->values(), leaf->m_count);
+    leaf_allocator_traits::destroy(m_leaf_allocator, leaf);
+    leaf_allocator_traits::deallocate(m_leaf_allocator, leaf, 1);
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+          std::size_t NodeBytes>
+void MyBTreeMapTypeContainer<Key, T, Compare, Allocator, NodeBytes>::
+    destroyInternal(internal_type* internal) noexcept {
+    if (internal->m_count > 0) {
+        std::destroy_n(internal->keys(), internal->m_count - 1);
+    }
+    internal_allocator_traits::destroy(m_internal_allocator, internal);
+    internal_allocator_traits::deallocate(m_internal_allocator, internal, 1);
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+          std::size_t NodeBytes>
+void MyBTreeMapTypeContainer<Key, T, Compare, Allocator, NodeBytes>::
+    destroySubtree(MyBTreeNodeBase* node) noexcept {
+    if (node->m_leaf) {
+        destroyLeaf(static_cast<leaf_type*>(node));
+        return;
+    }
+    auto* internal = static_cast<internal_type*>(node);
+    for (size_type i = 0; i < internal->m_count; ++i) {
+        destroySubtree(internal->m_children[i]);
+    }
+    destroyInternal(internal);
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+          std::size_t NodeBytes>
+std::size_t
+MyBTreeMapTypeContainer<Key, T, Compare, Allocator, NodeBytes>::childIndex(
+    const internal_type* internal, const Key& key) const {
+    // Потомок i содержит ключи из [разделитель i - 1, разделитель i)
+    return partitionPoint(
+        internal->keys(), internal->m_count - 1u,
+        [this, &key](const Key& separator) {
+            return !m_compare(key, separator);
+        });
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+          std::size_t NodeBytes>
+std::size_t
+MyBTreeMapTypeContainer<Key, T, Compare, Allocator, NodeBytes>::leafLowerBound(
+    const leaf_type* leaf, const Key& key) const {
+    return partitionPoint(leaf->values(), leaf->m_count,
+                          [this, &key](const value_type& value) {
+                              return m_compare(value.first, key);
+                          });
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+          std::size_t NodeBytes>
+std::size_t
+MyBTreeMapTypeContainer<Key, T, Compare, Allocator, NodeBytes>::leafUpperBound(
+    const leaf_type* leaf, const Key& key) const {
+    return partitionPoint(leaf->values(), leaf->m_count,
+                          [this, &key](const value_type& value) {
+                              return !m_compare(key, value.first);
+                          });
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+          std::size_t NodeBytes>
+typename MyBTreeMapTypeContainer<Key, T, Compare, Allocator,
+                                 NodeBytes>::leaf_type*
+MyBTreeMapTypeContainer<Key, T, Compare, Allocator, NodeBytes>::findLeaf(
+    const Key& key) const {
+    MyBTreeNodeBase* node = m_root;
+    while (!node->m_leaf) {
+        const auto* internal = static_cast<const internal_type*>(node);
+        node = internal->m_children[childIndex(internal, key)];
+    }
+    return static_cast<leaf_type*>(node);
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+          std::size_t NodeBytes>
+typename MyBTreeMapTypeContainer<Key, T, Compare, Allocator,
+                                 NodeBytes>::iterator
+MyBTreeMapTypeContainer<Key, T, Compare, Allocator, NodeBytes>::normalize(
+    leaf_type* leaf, size_type index) const noexcept {
+    // Ключи следующего листа не меньше разделителя, который привёл в leaf
+    if (index == leaf->m_count && leaf->m_next != nullptr) {
+        return iterator(leaf->m_next, 0);
+    }
+    return iterator(leaf, index);
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+          std::size_t NodeBytes>
+template <typename Construct>
+typename MyBTreeMapTypeContainer<Key, T, Compare, Allocator,
+                                 NodeBytes>::iterator
+MyBTreeMapTypeContainer<Key, T, Compare, Allocator, NodeBytes>::insertNew(
+    const Key& key, Construct construct) {
+    if (m_root == nullptr) {
+        leaf_type* leaf = createLeaf();
+        m_root = leaf;
+        m_first_leaf = leaf;
+        m_last_leaf = leaf;
+        m_height = 1;
+    } else if (m_root->m_count == (m_root->m_leaf ? leaf_capacity
+                                                   : internal_capacity)) {
+        // Заполненный корень уходит под новый корень и разбивается
+        internal_type* root = createInternal();
+        root->m_children[0] = m_root;
+        root->m_count = 1;
+        m_root = root;
+        ++m_height;
+    }
+    // Каждый узел на пути разбивается заранее, поэтому вставка в лист
+    // и разделителя в родителя всегда находит место
+    MyBTreeNodeBase* node = m_root;
+    bool rightmost = true;
+    while (!node->m_leaf) {
+        auto* internal = static_cast<internal_type*>(node);
+        size_type index = childIndex(internal, key);
+        MyBTreeNodeBase* child = internal->m_children[index];
+        if (child->m_leaf && child->m_count == leaf_capacity) {
+            const auto* leaf = static_cast<const leaf_type*>(child);
+            splitChild(internal, index,
+                       rightmost && index + 1 == internal->m_count &&
+                           m_compare(leaf->values()[leaf_capacity - 1].first,
+                                     key));
+            index = childIndex(internal, key);
+        } else if (!child->m_leaf && child->m_count == internal_capacity) {
+            const auto* inner = static_cast<const internal_type*>(child);
+            splitChild(internal, index,
+                       rightmost && index + 1 == internal->m_count &&
+                           childIndex(inner, key) + 1 == internal_capacity);
+            index = childIndex(internal, key);
+        }
+        rightmost = rightmost && index + 1 == internal->m_count;
+        node = internal->m_children[index];
+    }
+    auto* leaf = static_cast<leaf_type*>(node);
+    const size_type index = leafLowerBound(leaf, key);
+    value_type* values = leaf->values();
+    relocateBackward(values + index, leaf->m_count - index, values + index + 1);
+    try {
+        construct(values + index);
+    } catch (...) {
+        relocateForward(values + index + 1, leaf->m_count - index,
+                        values + index);
+        throw;
+    }
+    ++leaf->m_count;
+    ++m_size;
+    return iterator(leaf, index);
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+          std::size_t NodeBytes>
+void MyBTreeMapTypeContainer<Key, T, Compare, Allocator, NodeBytes>::
+    splitChild(internal_type* parent, size_type index, bool append) {
+    MyBTreeNodeBase* child = parent->m_children[index];
+    if (child->m_leaf) {
+        auto* left = static_cast<leaf_type*>(child);
+        leaf_type* right = createLeaf();
+        // При вставках в конец левый лист остаётся полным, а правый
+        // получает последний элемент — листья заполняются целиком
+        const size_type keep = append ? leaf_capacity - 1 : leaf_capacity / 2;
+        try {
+            insertChild(parent, index, left->values()[keep].first, right);
+        } catch (...) {
+            destroyLeaf(right);
+            throw;
+        }
+        relocateForward(left->values() + keep, leaf_capacity - keep,
+                        right->values());
+        right->m_count = static_cast<std::uint16_t>(leaf_capacity - keep);
+        left->m_count = static_cast<std::uint16_t>(keep);
+        right->m_prev = left;
+        right->m_next = left->m_next;
+        if (left->m_next != nullptr) {
+            left->m_next->m_prev = right;
+        } else {
+            m_last_leaf = right;
+        }
+        left->m_next = right;
+        return;
+    }
+    auto* left = static_cast<internal_type*>(child);
+    internal_type* right = createInternal();
+    // keep потомков остаются слева, разделитель keep - 1 уходит в
+    // родителя, остальные — направо
+    const size_type keep =
+        append ? internal_capacity - 1 : internal_capacity / 2;
+    try {
+        insertChild(parent, index, left->keys()[keep - 1], right);
+    } catch (...) {
+        destroyInternal(right);
+        throw;
+    }
+    relocateForward(left->keys() + keep, internal_capacity - 1 - keep,
+                    right->keys());
+    std::destroy_at(left->keys() + keep - 1);
+    std::copy(left->m_children + keep, left->m_children + internal_capacity,
+              right->m_children);
+    right->m_count = static_cast<std::uint16_t>(internal_capacity - keep);
+    left->m_count = static_cast<std::uint16_t>(keep);
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+          std::size_t NodeBytes>
+void MyBTreeMapTypeContainer<Key, T, Compare, Allocator, NodeBytes>::
+    insertChild(internal_type* parent, size_type index, const Key& key,
+                MyBTreeNodeBase* child) {
+    Key* keys = parent->keys();
+    const size_type key_count = parent->m_count - 1u;
+    relocateBackward(keys + index, key_count - index, keys + index + 1);
+    try {
+        std::construct_at(keys + index, key);
+    } catch (...) {
+        relocateForward(keys + index + 1, key_count - index, keys + index);
+        throw;
+    }
+    std::copy_backward(parent->m_children + index + 1,
+                       parent->m_children + parent->m_count,
+                       parent->m_children + parent->m_count + 1);
+    parent->m_children[index + 1] = child;
+    ++parent->m_count;
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+          std::size_t NodeBytes>
+void MyBTreeMapTypeContainer<Key, T, Compare, Allocator, NodeBytes>::
+    eraseExisting(const Key& key) {
+    MyBTreeNodeBase* node = m_root;
+    while (!node->m_leaf) {
+        auto* internal = static_cast<internal_type*>(node);
+        size_type index = childIndex(internal, key);
+        const MyBTreeNodeBase* child = internal->m_children[index];
+        if (child->m_count <= (child->m_leaf ? leaf_min : internal_min)) {
+            rebalanceChild(internal, index);
+            if (internal == m_root && internal->m_count == 1) {
+                // Корень с единственным потомком — дерево становится ниже
+                m_root = internal->m_children[0];
+                destroyInternal(internal);
+                --m_height;
+                node = m_root;
+                continue;
+            }
+            index = childIndex(internal, key);
+        }
+        node = internal->m_children[index];
+    }
+    auto* leaf = static_cast<leaf_type*>(node);
+    const size_type index = leafLowerBound(leaf, key);
+    value_type* values = leaf->values();
+    std::destroy_at(values + index);
+    relocateForward(values + index + 1, leaf->m_count - index - 1u,
+                    values + index);
+    --leaf->m_count;
+    --m_size;
+    if (leaf->m_count == 0) {
+        // Пустым может стать только корневой лист
+        destroyLeaf(leaf);
+        m_root = nullptr;
+        m_first_leaf = nullptr;
+        m_last_leaf = nullptr;
+        m_height = 0;
+    }
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+          std::size_t NodeBytes>
+void MyBTreeMapTypeContainer<Key, T, Compare, Allocator, NodeBytes>::
+    rebalanceChild(internal_type* parent, size_type index) {
+    MyBTreeNodeBase* child = parent->m_children[index];
+    MyBTreeNodeBase* left = index > 0 ? parent->m_children[index - 1] : nullptr;
+    MyBTreeNodeBase* right = index + 1 < parent->m_count
+                                 ? parent->m_children[index + 1]
+                                 : nullptr;
+    Key* separators = parent->keys();
+    if (child->m_leaf) {
+        auto* node = static_cast<leaf_type*>(child);
+        value_type* values = node->values();
+        if (left != nullptr && left->m_count > leaf_min) {
+            // Последний элемент левого соседа — в начало
+            auto* sibling = static_cast<leaf_type*>(left);
+            relocateBackward(values, node->m_count, values + 1);
+            relocateForward(sibling->values() + sibling->m_count - 1, 1,
+                            values);
+            --sibling->m_count;
+            ++node->m_count;
+            separators[index - 1] = values[0].first;
+        } else if (right != nullptr && right->m_count > leaf_min) {
+            // Первый элемент правого соседа — в конец
+            auto* sibling = static_cast<leaf_type*>(right);
+            relocateForward(sibling->values(), 1, values + node->m_count);
+            relocateForward(sibling->values() + 1, sibling->m_count - 1u,
+                            sibling->values());
+            --sibling->m_count;
+            ++node->m_count;
+            separators[index] = sibling->values()[0].first;
+        } else {
+            mergeLeaves(parent, left != nullptr ? index - 1 : index);
+        }
+        return;
+    }
+    auto* node = static_cast<internal_type*>(child);
+    if (left != nullptr && left->m_count > internal_min) {
+        // Разделитель родителя опускается в начало узла, последний ключ
+        // левого соседа поднимается на его место
+        auto* sibling = static_cast<internal_type*>(left);
+        relocateBackward(node->keys(), node->m_count - 1u, node->keys() + 1);
+        relocateForward(separators + index - 1, 1, node->keys());
+        relocateForward(sibling->keys() + sibling->m_count - 2, 1,
+                        separators + index - 1);
+        std::copy_backward(node->m_children, node->m_children + node->m_count,
+                           node->m_children + node->m_count + 1);
+        node->m_children[0] = sibling->m_children[sibling->m_count - 1];
+        --sibling->m_count;
+        ++node->m_count;
+    } else if (right != nullptr && right->m_count > internal_min) {
+        auto* sibling = static_cast<internal_type*>(right);
+        relocateForward(separators + index, 1,
+                        node->keys() + node->m_count - 1);
+        relocateForward(sibling->keys(), 1, separators + index);
+        relocateForward(sibling->keys() + 1, sibling->m_count - 2u,
+                        sibling->keys());
+        node->m_children[node->m_count] = sibling->m_children[0];
+        std::copy(sibling->m_children + 1,
+                  sibling->m_children + sibling->m_count,
+                  sibling->m_children);
+        --sibling->m_count;
+        ++node->m_count;
+    } else {
+        mergeInternals(parent, left != nullptr ? index - 1 : index);
+    }
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+          std::size_t NodeBytes>
+void MyBTreeMapTypeContainer<Key, T, Compare, Allocator, NodeBytes>::
+    mergeLeaves(internal_type* parent, size_type index) {
+    auto* left = static_cast<leaf_type*>(parent->m_children[index]);
+    auto* right = static_cast<leaf_type*>(parent->m_children[index + 1]);
+    relocateForward(right->values(), right->m_count,
+                    left->values() + left->m_count);
+    left->m_count = static_cast<std::uint16_t>(left->m_count + right->m_count);
+    right->m_count = 0;
+    left->m_next = right->m_next;
+    if (right->m_next != nullptr) {
+        right->m_next->m_prev = left;
+    } else {
+        m_last_leaf = left;
+    }
+    destroyLeaf(right);
+    std::destroy_at(parent->keys() + index);
+    removeChild(parent, index);
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+          std::size_t NodeBytes>
+void MyBTreeMapTypeContainer<Key, T, Compare, Allocator, NodeBytes>::
+    mergeInternals(internal_type* parent, size_type index) {
+    auto* left = static_cast<internal_type*>(parent->m_children[index]);
+    auto* right = static_cast<internal_type*>(parent->m_children[index + 1]);
+    // Разделитель родителя оказывается между ключами левого и правого
+    relocateForward(parent->keys() + index, 1,
+                    left->keys() + left->m_count - 1);
+    relocateForward(right->keys(), right->m_count - 1u,
+                    left->keys() + left->m_count);
+    std::copy(right->m_children, right->m_children + right->m_count,
+              left->m_children + left->m_count);
+    left->m_count = static_cast<std::uint16_t>(left->m_count + right->m_count);
+    right->m_count = 0;
+    destroyInternal(right);
+    removeChild(parent, index);
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+          std::size_t NodeBytes>
+void MyBTreeMapTypeContainer<Key, T, Compare, Allocator, NodeBytes>::
+    removeChild(internal_type* parent, size_type index) noexcept {
+    relocateForward(parent->keys() + index + 1, parent->m_count - index - 2u,
+                    parent->keys() + index);
+    std::copy(parent->m_children + index + 2,
+              parent->m_children + parent->m_count,
+              parent->m_children + index + 1);
+    --parent->m_count;
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+          std::size_t NodeBytes>
+void MyBTreeMapTypeContainer<Key, T, Compare, Allocator, NodeBytes>::stealFrom(
+    MyBTreeMapTypeContainer& other) noexcept {
+    m_root = std::exchange(other.m_root, nullptr);
+    m_first_leaf = std::exchange(other.m_first_leaf, nullptr);
+    m_last_leaf = std::exchange(other.m_last_leaf, nullptr);
+    m_size = std::exchange(other.m_size, 0);
+    m_height = std::exchange(other.m_height, 0);
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+          std::size_t NodeBytes>
+template <typename U, typename Predicate>
+std::size_t
+MyBTreeMapTypeContainer<Key, T, Compare, Allocator, NodeBytes>::partitionPoint(
+    const U* first, size_type count, Predicate before) {
+    if (count == 0) {
+        return 0;
+    }
+    // Ответ всегда в [base, base + count]
+    const U* base = first;
+    while (count > 1) {
+        const size_type half = count / 2;
+        base = before(base[half]) ? base + half : base;
+        count -= half;
+    }
+    return static_cast<size_type>(base - first) + (before(*base) ? 1u : 0u);
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+          std::size_t NodeBytes>
+template <typename U>
+void MyBTreeMapTypeContainer<Key, T, Compare, Allocator, NodeBytes>::
+    relocateForward(U* src, size_type count, U* dst) noexcept {
+    for (size_type i = 0; i < count; ++i) {
+        std::construct_at(dst + i, std::move(src[i]));
+        std::destroy_at(src + i);
+    }
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+          std::size_t NodeBytes>
+template <typename U>
+void MyBTreeMapTypeContainer<Key, T, Compare, Allocator, NodeBytes>::
+    relocateBackward(U* src, size_type count, U* dst) noexcept {
+    for (size_type i = count; i > 0; --i) {
+        std::construct_at(dst + i - 1, std::move(src[i - 1]));
+        std::destroy_at(src + i - 1);
+    }
+}
@@ -0,0 +1,435 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "slot_pool.hpp"
+
+// Потокобезопасный пул слотов одного размера.
+// Глобальный free‑list — lock-free стек пачек (batch) слотов; вершина
+// стека хранится как 32-битный индекс слота + 32-битный тег (защита от
+// ABA) в одном std::atomic<std::uint64_t>. Новая память нарезается из
+// чанков под мьютексом — это редкая операция.
+class ConcurrentSlotPool {
+public:
+    // Ёмкость магазина (per-thread кэша), обмен с пулом — половиной
+    static constexpr std::size_t magazine_size = 64;
+    static constexpr std::size_t batch_size = magazine_size / 2;
+
+    ConcurrentSlotPool(std::size_t slot_size, std::size_t slot_align,
+                       std::size_t chunk_slots, GrowthPolicy growth)
+        : m_slot_align{slot_align < alignof(FreeSlot) ? alignof(FreeSlot)
+                                                      : slot_align},
+          m_slot_size{roundUp(slot_size < sizeof(FreeSlot) ? sizeof(FreeSlot)
+                                                           : slot_size,
+                              m_slot_align)},
+          m_chunk_slots{chunk_slots},
+          m_growth{growth},
+          m_id{nextId()} {
+        if (growth == GrowthPolicy::Linear) {
+            // таблица чанков ограничена, линейный рост быстро её исчерпает
+            m_growth = GrowthPolicy::Geometric;
+        }
+    }
+    ConcurrentSlotPool(const ConcurrentSlotPool&) = delete;
+    ConcurrentSlotPool& operator=(const ConcurrentSlotPool&) = delete;
+
+    ~ConcurrentSlotPool() {
+        for (std::size_t k = 0; k < m_chunk_count; ++k) {
+            ::operator delete(m_chunks[k].load(std::memory_order_relaxed),
+                              static_cast<std::align_val_t>(m_slot_align));
+        }
+    }
+
+    // Забрать до max_count слотов в out; возвращает сколько забрано
+    std::size_t popBatch(void** out, std::size_t max_count) {
+        std::uint64_t head = m_head.load(std::memory_order_acquire);
+        while ((head & index_mask) != 0) {
+            FreeSlot* first = slotAt((head & index_mask) - 1);
+            // слот мог быть уже выдан другому потоку — тогда значение
+            // мусорное, но CAS не пройдёт из-за изменившегося тега
+            const std::uint32_t next =
+                std::atomic_ref<std::uint32_t>{first->next_batch}.load(
+                    std::memory_order_relaxed);
+            const std::uint64_t new_head = nextTag(head) | next;
+            if (m_head.compare_exchange_weak(head, new_head,
+                                             std::memory_order_acquire,
+                                             std::memory_order_acquire)) {
+                std::size_t count = 0;
+                for (FreeSlot* slot = first;
+                     slot != nullptr && count < max_count; slot = slot->next) {
+                    out[count++] = slot;
+                }
+                return count;
+            }
+        }
+        return carve(out, max_count);
+    }
+
+    // Вернуть count слотов одной пачкой (count <= batch_size)
+    void pushBatch(void* const* slots, std::size_t count) noexcept {
+        if (count == 0) {
+            return;
+        }
+        FreeSlot* first = nullptr;
+        for (std::size_t i = count; i-- > 0;) {
+            first = ::new (slots[i]) FreeSlot{first, 0};
+        }
+        const std::uint64_t index = indexOf(first) + 1;
+        std::uint64_t head = m_head.load(std::memory_order_relaxed);
+        do {
+            std::atomic_ref<std::uint32_t>{first->next_batch}.store(
+                static_cast<std::uint32_t>(head & index_mask),
+                std::memory_order_relaxed);
+        } while (!m_head.compare_exchange_weak(head, nextTag(head) | index,
+                                               std::memory_order_release,
+                                               std::memory_order_relaxed));
+    }
+
+    // Уникальный идентификатор пула (адрес может быть переиспользован)
+    [[nodiscard]]
+    std::uint64_t id() const noexcept {
+        return m_id;
+    }
+
+    [[nodiscard]]
+    std::size_t max_slots() const noexcept {
+        if (m_growth == GrowthPolicy::Fixed) {
+            return m_chunk_slots;
+        }
+        return index_mask - 1;
+    }
+private:
+    struct FreeSlot {
+        FreeSlot* next;            // следующий слот внутри пачки
+        std::uint32_t next_batch;  // индекс+1 головы следующей пачки, 0 — нет
+    };
+
+    static constexpr std::size_t max_chunks = 32;
+    static constexpr std::uint64_t index_mask = 0xFFFF'FFFFU;
+
+    static constexpr std::size_t roundUp(std::size_t value,
+                                         std::size_t align) noexcept {
+        return (value + align - 1) / align * align;
+    }
+
+    static std::uint64_t nextTag(std::uint64_t head) noexcept {
+        return ((head >> 32U) + 1) << 32U;
+    }
+
+    static std::uint64_t nextId() noexcept {
+        static std::atomic<std::uint64_t> counter{0};
+        return counter.fetch_add(1, std::memory_order_relaxed) + 1;
+    }
+
+    // Ёмкость чанка с номером k
+    std::size_t chunkCapacity(std::size_t k) const noexcept {
+        return m_growth == GrowthPolicy::Geometric ? m_chunk_slots << k
+                                                   : m_chunk_slots;
+    }
+
+    // Глобальный индекс первого слота чанка с номером k
+    std::size_t chunkBase(std::size_t k) const noexcept {
+        return m_growth == GrowthPolicy::Geometric
+                   ? m_chunk_slots * ((std::size_t{1} << k) - 1)
+                   : m_chunk_slots * k;
+    }
+
+    // Слот по глобальному индексу — O(1)
+    FreeSlot* slotAt(std::uint64_t index) const noexcept {
+        const auto quotient = static_cast<std::size_t>(index) / m_chunk_slots;
+        const std::size_t k =
+            m_growth == GrowthPolicy::Geometric
+                ? static_cast<std::size_t>(std::bit_width(quotient + 1)) - 1
+                : quotient;
+        unsigned char* chunk = m_chunks[k].load(std::memory_order_acquire);
+        return reinterpret_cast<FreeSlot*>(
+            chunk + (static_cast<std::size_t>(index) - chunkBase(k)) *
+                        m_slot_size);
+    }
+
+    // Глобальный индекс слота по адресу — поиск среди O(log n) чанков,
+    // вызывается один раз на пачку
+    std::uint64_t indexOf(const void* ptr) const noexcept {
+        const auto address = reinterpret_cast<std::uintptr_t>(ptr);
+        const std::size_t count = m_published.load(std::memory_order_acquire);
+        for (std::size_t k = count; k-- > 0;) {
+            const auto begin = reinterpret_cast<std::uintptr_t>(
+                m_chunks[k].load(std::memory_order_relaxed));
+            if (address >= begin &&
+                address < begin + chunkCapacity(k) * m_slot_size) {
+                return chunkBase(k) + (address - begin) / m_slot_size;
+            }
+        }
+        return 0;  // недостижимо для слотов этого пула
+    }
+
+    // Нарезать новые слоты из чанков (под мьютексом)
+    std::size_t carve(void** out, std::size_t max_count) {
+        const std::lock_guard<std::mutex> lock{m_grow_mutex};
+        std::size_t count = 0;
+        while (count < max_count) {
+            if (m_bump == m_bump_end) {
+                if (count != 0) {
+                    break;  // не растём, пока есть что отдать
+                }
+                grow();
+            }
+            out[count++] = m_bump;
+            m_bump += m_slot_size;
+        }
+        return count;
+    }
+
+    void grow() {
+        if ((m_growth == GrowthPolicy::Fixed && m_chunk_count != 0) ||
+            m_chunk_count == max_chunks) {
+            throw std::bad_alloc();  // свободных слотов нет
+        }
+        const std::size_t new_slots = chunkCapacity(m_chunk_count);
+        if (chunkBase(m_chunk_count) + new_slots >= index_mask ||
+            new_slots > std::numeric_limits<std::size_t>::max() / m_slot_size) {
+            throw std::bad_alloc();  // индекс слота не помещается в 32 бита
+        }
+        auto* chunk = static_cast<unsigned char*>(
+            ::operator new(new_slots * m_slot_size,
+                           static_cast<std::align_val_t>(m_slot_align)));
+        m_chunks[m_chunk_count].store(chunk, std::memory_order_release);
+        ++m_chunk_count;
+        m_published.store(m_chunk_count, std::memory_order_release);
+        m_bump = chunk;
+        m_bump_end = chunk + new_slots * m_slot_size;
+    }
+
+    std::size_t m_slot_align;
+    std::size_t m_slot_size;
+    std::size_t m_chunk_slots;
+    GrowthPolicy m_growth;
+    std::uint64_t m_id;
+
+    // Вершина стека пачек: старшие 32 бита — тег, младшие — индекс+1
+    alignas(64) std::atomic<std::uint64_t> m_head{0};
+
+    alignas(64) std::mutex m_grow_mutex;
+    std::array<std::atomic<unsigned char*>, max_chunks> m_chunks{};
+    std::atomic<std::size_t> m_published{0};  // число опубликованных чанков
+    std::size_t m_chunk_count{0};
+    unsigned char* m_bump{nullptr};
+    unsigned char* m_bump_end{nullptr};
+};
+
+// Per-thread кэш слотов (магазины) для нескольких пулов.
+// При завершении потока слоты возвращаются в ещё живые пулы.
+class ConcurrentThreadCache {
+public:
+    struct Magazine {
+        std::uint64_t pool_id{0};
+        std::weak_ptr<ConcurrentSlotPool> owner;
+        std::size_t count{0};
+        std::array<void*, ConcurrentSlotPool::magazine_size> slots{};
+    };
+
+    ConcurrentThreadCache() = default;
+    ConcurrentThreadCache(const ConcurrentThreadCache&) = delete;
+    ConcurrentThreadCache& operator=(const ConcurrentThreadCache&) = delete;
+
+    ~ConcurrentThreadCache() {
+        for (Magazine& magazine : m_magazines) {
+            flush(magazine);
+        }
+    }
+
+    static ConcurrentThreadCache& local() {
+        static thread_local ConcurrentThreadCache cache;
+        return cache;
+    }
+
+    // Магазин текущего потока для пула
+    Magazine& magazine(const std::shared_ptr<ConcurrentSlotPool>& pool) {
+        const std::uint64_t id = pool->id();
+        for (Magazine& magazine : m_magazines) {
+            if (magazine.pool_id == id) {
+                return magazine;
+            }
+        }
+        // вытеснение по кругу
+        Magazine& victim = m_magazines[m_victim];
+        m_victim = (m_victim + 1) % m_magazines.size();
+        flush(victim);
+        victim.pool_id = id;
+        victim.owner = pool;
+        return victim;
+    }
+private:
+    static void flush(Magazine& magazine) noexcept {
+        if (magazine.count != 0) {
+            if (auto pool = magazine.owner.lock()) {
+                for (std::size_t pos = 0; pos < magazine.count;
+                     pos += ConcurrentSlotPool::batch_size) {
+                    const std::size_t left = magazine.count - pos;
+                    pool->pushBatch(magazine.slots.data() + pos,
+                                    left < ConcurrentSlotPool::batch_size
+                                        ? left
+                                        : ConcurrentSlotPool::batch_size);
+                }
+            }
+        }
+        magazine.count = 0;
+        magazine.pool_id = 0;
+        magazine.owner.reset();
+    }
+
+    std::array<Magazine, 4> m_magazines{};
+    std::size_t m_victim{0};
+};
+
+// Арена потокобезопасных пулов, разделяемая копиями и rebind-версиями
+class ConcurrentPoolArena {
+public:
+    ConcurrentPoolArena(std::size_t chunk_slots, GrowthPolicy growth) noexcept
+        : m_chunk_slots{chunk_slots}, m_growth{growth} {
+    }
+
+    // Найти (или создать) пул для слотов данного размера/выравнивания
+    std::shared_ptr<ConcurrentSlotPool> acquire(std::size_t slot_size,
+                                                std::size_t slot_align) {
+        const std::lock_guard<std::mutex> lock{m_mutex};
+        for (const PoolEntry& entry : m_pools) {
+            if (entry.slot_size == slot_size && entry.slot_align == slot_align) {
+                return entry.pool;
+            }
+        }
+        auto pool = std::make_shared<ConcurrentSlotPool>(
+            slot_size, slot_align, m_chunk_slots, m_growth);
+        m_pools.push_back(PoolEntry{slot_size, slot_align, pool});
+        return pool;
+    }
+private:
+    struct PoolEntry {
+        std::size_t slot_size;
+        std::size_t slot_align;
+        std::shared_ptr<ConcurrentSlotPool> pool;
+    };
+
+    std::size_t m_chunk_slots;
+    GrowthPolicy m_growth;
+    std::mutex m_mutex;
+    std::vector<PoolEntry> m_pools;
+};
+
+// Потокобезопасный вариант FixedAllocator: выделение/освобождение идут
+// через per-thread магазины, с общим пулом — обмен пачками. Узел можно
+// освободить в другом потоке: он попадёт в магазин этого потока.
+// GrowthPolicy::Linear трактуется как Geometric (таблица чанков
+// ограничена 32 элементами), при Fixed часть из N слотов может лежать
+// в магазинах других потоков. Пул value_type берётся из арены при
+// создании аллокатора, поэтому один объект аллокатора можно использовать
+// из нескольких потоков одновременно (так делает
+// MyConcurrentQueueTypeContainer).
+template <typename T, std::size_t N,
+          GrowthPolicy Growth = GrowthPolicy::Geometric>
+class ConcurrentFixedAllocator {
+    static_assert(N > 0,
+                  "ConcurrentFixedAllocator: N must be greater than zero");
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_copy_assignment = std::false_type;
+    using propagate_on_container_swap = std::false_type;
+
+    using is_always_equal = std::false_type;
+
+    // rebind для STL-совместимости
+    template <class U>
+    struct rebind {
+        using other = ConcurrentFixedAllocator<U, N, Growth>;
+    };
+
+    ConcurrentFixedAllocator()
+        : arena{std::make_shared<ConcurrentPoolArena>(N, Growth)},
+          pool{arena->acquire(sizeof(value_type), alignof(value_type))} {
+    }
+    ConcurrentFixedAllocator(const ConcurrentFixedAllocator&) noexcept =
+        default;
+    template <class U>
+    ConcurrentFixedAllocator(
+        const ConcurrentFixedAllocator<U, N, Growth>& other)
+        : arena{other.arena},
+          pool{arena->acquire(sizeof(value_type), alignof(value_type))} {
+    }
+    auto operator=(const ConcurrentFixedAllocator&) noexcept
+        -> ConcurrentFixedAllocator& = default;
+    ~ConcurrentFixedAllocator() = default;
+
+    [[nodiscard]]
+    auto select_on_container_copy_construction() const
+        -> ConcurrentFixedAllocator {
+        return ConcurrentFixedAllocator{};
+    }
+
+    // Выделение памяти
+    [[nodiscard]]
+    auto allocate(size_type count) -> T* {
+        if (count == 0) {
+            return nullptr;
+        }
+        if (count != 1) {  // аллокатор выделяет только по одному элементу
+            throw std::bad_alloc();
+        }
+        auto& magazine = ConcurrentThreadCache::local().magazine(pool);
+        if (magazine.count == 0) {
+            magazine.count = pool->popBatch(magazine.slots.data(),
+                                            ConcurrentSlotPool::batch_size);
+        }
+        return static_cast<T*>(magazine.slots[--magazine.count]);
+    }
+
+    // слот вернуть в магазин текущего потока
+    void deallocate(T* ptr, size_type count) noexcept {
+        if (!ptr || count == 0) {
+            return;
+        }
+        auto& magazine = ConcurrentThreadCache::local().magazine(pool);
+        if (magazine.count == ConcurrentSlotPool::magazine_size) {
+            magazine.count -= ConcurrentSlotPool::batch_size;
+            pool->pushBatch(magazine.slots.data() + magazine.count,
+                            ConcurrentSlotPool::batch_size);
+        }
+        magazine.slots[magazine.count++] = ptr;
+    }
+
+    [[nodiscard]]
+    auto max_size() const noexcept -> size_type {
+        if constexpr (Growth == GrowthPolicy::Fixed) {
+            return N;
+        } else {
+            return std::numeric_limits<std::uint32_t>::max() - 1;
+        }
+    }
+
+    template <typename U, std::size_t M, GrowthPolicy G>
+    friend class ConcurrentFixedAllocator;
+
+    // Аллокаторы равны, если разделяют одну арену
+    template <typename U>
+    auto operator==(const ConcurrentFixedAllocator<U, N, Growth>& other)
+        const noexcept -> bool {
+        return arena == other.arena;
+    }
+private:
+    std::shared_ptr<ConcurrentPoolArena> arena;
+    std::shared_ptr<ConcurrentSlotPool> pool;  // пул value_type в арене
+};
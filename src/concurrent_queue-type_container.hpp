@@ -0,0 +1,466 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "unidir_list-type_container.hpp"
+
+// Домен hazard pointers: каждый поток, работающий со структурой, держит
+// запись с hazards_per_record защищёнными указателями. Узел, исключённый
+// из структуры, откладывается в список записи и освобождается только
+// тогда, когда ни одна запись его не защищает. Записи не удаляются до
+// смерти домена и переиспользуются потоками.
+class HazardDomain {
+public:
+    static constexpr std::size_t hazards_per_record = 2;
+    // Отложенные узлы потока проверяются, когда их набирается столько
+    static constexpr std::size_t scan_threshold = 64;
+
+    struct Record {
+        std::array<std::atomic<void*>, hazards_per_record> hazards{};
+        std::atomic<bool> active{false};
+        Record* next{nullptr};       // следующая запись домена
+        std::vector<void*> retired;  // принадлежит владельцу записи
+        std::vector<void*> scratch;  // защищённые адреса для scan()
+    };
+
+    HazardDomain() noexcept : m_id{nextId()} {
+    }
+    HazardDomain(const HazardDomain&) = delete;
+    HazardDomain& operator=(const HazardDomain&) = delete;
+
+    // Отложенные узлы к этому моменту должны быть освобождены (drain)
+    ~HazardDomain() {
+        Record* record = m_records.load(std::memory_order_acquire);
+        while (record != nullptr) {
+            Record* next = record->next;
+            delete record;
+            record = next;
+        }
+    }
+
+    // Занять свободную запись или добавить новую (lock-free)
+    Record& acquire() {
+        for (Record* record = m_records.load(std::memory_order_acquire);
+             record != nullptr; record = record->next) {
+            bool expected = false;
+            if (!record->active.load(std::memory_order_relaxed) &&
+                record->active.compare_exchange_strong(
+                    expected, true, std::memory_order_acq_rel)) {
+                return *record;
+            }
+        }
+        auto* record = new Record;
+        record->active.store(true, std::memory_order_relaxed);
+        record->retired.reserve(scan_threshold);
+        Record* head = m_records.load(std::memory_order_relaxed);
+        do {
+            record->next = head;
+        } while (!m_records.compare_exchange_weak(head, record,
+                                                  std::memory_order_release,
+                                                  std::memory_order_relaxed));
+        return *record;
+    }
+
+    // Вернуть запись домену; отложенные узлы достанутся следующему владельцу
+    void release(Record& record) noexcept {
+        for (auto& hazard : record.hazards) {
+            hazard.store(nullptr, std::memory_order_release);
+        }
+        record.active.store(false, std::memory_order_release);
+    }
+
+    // Отложить освобождение ptr; reclaim(ptr) вызывается, когда ptr
+    // больше никем не защищён
+    template <typename Reclaim>
+    void retire(Record& record, void* ptr, Reclaim reclaim) {
+        record.retired.push_back(ptr);
+        if (record.retired.size() >= scan_threshold) {
+            scan(record, reclaim);
+        }
+    }
+
+    // Освободить всё отложенное во всех записях — только когда со
+    // структурой больше никто не работает
+    template <typename Reclaim>
+    void drain(Reclaim reclaim) {
+        for (Record* record = m_records.load(std::memory_order_acquire);
+             record != nullptr; record = record->next) {
+            for (void* ptr : record->retired) {
+                reclaim(ptr);
+            }
+            record->retired.clear();
+        }
+    }
+
+    // Уникальный идентификатор домена (адрес может быть переиспользован)
+    [[nodiscard]]
+    std::uint64_t id() const noexcept {
+        return m_id;
+    }
+private:
+    static std::uint64_t nextId() noexcept {
+        static std::atomic<std::uint64_t> counter{0};
+        return counter.fetch_add(1, std::memory_order_relaxed) + 1;
+    }
+
+    // Освободить отложенные узлы, которые не защищены ни одной записью
+    template <typename Reclaim>
+    void scan(Record& record, Reclaim reclaim) {
+        auto& hazards = record.scratch;
+        hazards.clear();
+        for (const Record* other = m_records.load(std::memory_order_acquire);
+             other != nullptr; other = other->next) {
+            for (const auto& hazard : other->hazards) {
+                if (void* ptr = hazard.load(); ptr != nullptr) {
+                    hazards.push_back(ptr);
+                }
+            }
+        }
+        std::sort(hazards.begin(), hazards.end());
+        const auto kept = std::partition(
+            record.retired.begin(), record.retired.end(), [&](void* ptr) {
+                return std::binary_search(hazards.begin(), hazards.end(), ptr);
+            });
+        for (auto it = kept; it != record.retired.end(); ++it) {
+            reclaim(*it);
+        }
+        record.retired.erase(kept, record.retired.end());
+    }
+
+    std::uint64_t m_id;
+    std::atomic<Record*> m_records{nullptr};
+};
+
+// Записи hazard pointers текущего потока для нескольких доменов.
+// При вытеснении и завершении потока записи возвращаются в ещё живые
+// домены.
+class HazardThreadCache {
+public:
+    HazardThreadCache() = default;
+    HazardThreadCache(const HazardThreadCache&) = delete;
+    HazardThreadCache& operator=(const HazardThreadCache&) = delete;
+
+    ~HazardThreadCache() {
+        for (Entry& entry : m_entries) {
+            flush(entry);
+        }
+    }
+
+    static HazardThreadCache& local() {
+        static thread_local HazardThreadCache cache;
+        return cache;
+    }
+
+    // Запись текущего потока в домене
+    HazardDomain::Record& record(const std::shared_ptr<HazardDomain>& domain) {
+        const std::uint64_t id = domain->id();
+        for (Entry& entry : m_entries) {
+            if (entry.domain_id == id) {
+                return *entry.record;
+            }
+        }
+        // вытеснение по кругу
+        Entry& victim = m_entries[m_victim];
+        m_victim = (m_victim + 1) % m_entries.size();
+        flush(victim);
+        victim.record = &domain->acquire();
+        victim.domain_id = id;
+        victim.owner = domain;
+        return *victim.record;
+    }
+private:
+    struct Entry {
+        std::uint64_t domain_id{0};
+        std::weak_ptr<HazardDomain> owner;
+        HazardDomain::Record* record{nullptr};
+    };
+
+    static void flush(Entry& entry) noexcept {
+        if (entry.record != nullptr) {
+            if (auto domain = entry.owner.lock()) {
+                domain->release(*entry.record);
+            }
+        }
+        entry.domain_id = 0;
+        entry.owner.reset();
+        entry.record = nullptr;
+    }
+
+    std::array<Entry, 4> m_entries{};
+    std::size_t m_victim{0};
+};
+
+// Потокобезопасная очередь (MPMC, в частности MPSC) по схеме Michael–Scott
+// на узлах MyUniDirNode: push добавляет за хвостом, try_pop снимает
+// элемент следующего за фиктивной головой узла, и этот узел становится
+// новой головой. Ссылки m_next читаются и изменяются через
+// std::atomic_ref, снятые головы освобождаются через hazard pointers.
+// Аллокатор узлов вызывается из разных потоков одновременно — подходят
+// std::allocator и ConcurrentFixedAllocator.
+// Элемент переносится в try_pop после того, как узел уже снят с очереди,
+// поэтому перемещающее присваивание T не должно бросать исключений.
+template <typename T, typename Allocator = std::allocator<T>>
+class MyConcurrentQueueTypeContainer {
+public:
+    MyConcurrentQueueTypeContainer() : MyConcurrentQueueTypeContainer(
+                                           Allocator()) {
+    }
+    explicit MyConcurrentQueueTypeContainer(const Allocator& alloc);
+    MyConcurrentQueueTypeContainer(const MyConcurrentQueueTypeContainer&) =
+        delete;
+    MyConcurrentQueueTypeContainer& operator=(
+        const MyConcurrentQueueTypeContainer&) = delete;
+    // Вызывается, когда с очередью больше никто не работает
+    ~MyConcurrentQueueTypeContainer();
+    void push(const T& value);
+    void push(T&& value);
+    template <typename... Args>
+    void emplace(Args&&... args);
+    // false — очередь пуста
+    bool try_pop(T& value);
+    std::optional<T> try_pop();
+    // Моментальный снимок: к моменту возврата может устареть
+    bool empty() const;
+    Allocator get_allocator() const;
+
+    using value_type = T;
+    using allocator_type = Allocator;
+    using size_type = std::size_t;
+
+    using node_base_type = MyUniDirNodeBase<T>;
+    using node_type = MyUniDirNode<T>;
+    using node_allocator_type = typename std::allocator_traits<
+        allocator_type>::template rebind_alloc<node_type>;
+    using node_allocator_traits = std::allocator_traits<node_allocator_type>;
+private:
+    using next_ref = std::atomic_ref<node_type*>;
+
+    template <typename... Args>
+    node_type* createNode(Args&&... args);
+    void destroyNode(node_type* node);
+    // Присоединить готовый узел за хвостом
+    void link(node_type* node);
+    // Прочитать src и опубликовать значение в hazard-слоте slot
+    static node_base_type* protect(HazardDomain::Record& record,
+                                   std::size_t slot,
+                                   const std::atomic<node_base_type*>& src);
+    // Снять голову; возвращает следующий узел — он хранит элемент и
+    // становится новой головой. Снятая голова остаётся в hazard-слоте 0,
+    // узел с элементом — в слоте 1
+    node_type* unlinkHead(HazardDomain::Record& record);
+    // Снять защиту и отложить освобождение снятой головы
+    void retireHead(HazardDomain::Record& record);
+    // Освобождение узла, отложенного через HazardDomain
+    void reclaim(void* ptr);
+
+    // Начальная фиктивная голова не выделяется аллокатором
+    node_base_type m_stub{};
+    alignas(64) std::atomic<node_base_type*> m_head{&m_stub};
+    alignas(64) std::atomic<node_base_type*> m_tail{&m_stub};
+    alignas(64) node_allocator_type m_node_allocator;
+    std::shared_ptr<HazardDomain> m_hazards;
+};
+
+template <typename T, typename Allocator>
+MyConcurrentQueueTypeContainer<T, Allocator>::MyConcurrentQueueTypeContainer(
+    const Allocator& alloc)
+    : m_node_allocator(alloc), m_hazards{std::make_shared<HazardDomain>()} {
+}
+
+template <typename T, typename Allocator>
+MyConcurrentQueueTypeContainer<T,
+                               Allocator>::~MyConcurrentQueueTypeContainer() {
+    m_hazards->drain([this](void* ptr) { reclaim(ptr); });
+    node_base_type* head = m_head.load(std::memory_order_acquire);
+    node_type* node = head->m_next;
+    if (head != &m_stub) {
+        destroyNode(static_cast<node_type*>(head));
+    }
+    while (node != nullptr) {
+        node_type* next = node->m_next;
+        destroyNode(node);
+        node = next;
+    }
+}
+
+template <typename T, typename Allocator>
+void MyConcurrentQueueTypeContainer<T, Allocator>::push(const T& value) {
+    link(createNode(value));
+}
+
+template <typename T, typename Allocator>
+void MyConcurrentQueueTypeContainer<T, Allocator>::push(T&& value) {
+    link(createNode(std::move(value)));
+}
+
+template <typename T, typename Allocator>
+template <typename... Args>
+void MyConcurrentQueueTypeContainer<T, Allocator>::emplace(Args&&... args) {
+    link(createNode(std::forward<Args>(args)...));
+}
+
+template <typename T, typename Allocator>
+bool MyConcurrentQueueTypeContainer<T, Allocator>::try_pop(T& value) {
+    HazardDomain::Record& record = HazardThreadCache::local().record(m_hazards);
+    node_type* next = unlinkHead(record);
+    if (next == nullptr) {
+        return false;
+    }
+    value = std::move(next->m_data);
+    retireHead(record);
+    return true;
+}
+
+template <typename T, typename Allocator>
+std::optional<T> MyConcurrentQueueTypeContainer<T, Allocator>::try_pop() {
+    HazardDomain::Record& record = HazardThreadCache::local().record(m_hazards);
+    node_type* next = unlinkHead(record);
+    if (next == nullptr) {
+        return std::nullopt;
+    }
+    std::optional<T> value{std::move(next->m_data)};
+    retireHead(record);
+    return value;
+}
+
+template <typename T, typename Allocator>
+bool MyConcurrentQueueTypeContainer<T, Allocator>::empty() const {
+    HazardDomain::Record& record = HazardThreadCache::local().record(m_hazards);
+    node_base_type* head = protect(record, 0, m_head);
+    const bool result =
+        next_ref{head->m_next}.load(std::memory_order_acquire) == nullptr;
+    record.hazards[0].store(nullptr, std::memory_order_release);
+    return result;
+}
+
+template <typename T, typename Allocator>
+Allocator MyConcurrentQueueTypeContainer<T, Allocator>::get_allocator()
+    const {
+    return Allocator(m_node_allocator);
+}
+
+template <typename T, typename Allocator>
+template <typename... Args>
+typename MyConcurrentQueueTypeContainer<T, Allocator>::node_type*
+MyConcurrentQueueTypeContainer<T, Allocator>::createNode(Args&&... args) {
+    node_type* node = node_allocator_traits::allocate(m_node_allocator, 1U);
+    try {
+        node_allocator_traits::construct(m_node_allocator, node,
+                                         std::in_place,
+                                         std::forward<Args>(args)...);
+    } catch (...) {
+        node_allocator_traits::deallocate(m_node_allocator, node, 1U);
+        throw;
+    }
+    return node;
+}
+
+template <typename T, typename Allocator>
+void MyConcurrentQueueTypeContainer<T, Allocator>::destroyNode(
+    node_type* node) {
+    node_allocator_traits::destroy(m_node_allocator, node);
+    node_allocator_traits::deallocate(m_node_allocator, node, 1U);
+}
+
+template <typename T, typename Allocator>
+void MyConcurrentQueueTypeContainer<T, Allocator>::link(node_type* node) {
+    HazardDomain::Record& record = HazardThreadCache::local().record(m_hazards);
+    while (true) {
+        node_base_type* tail = protect(record, 0, m_tail);
+        node_type* next =
+            next_ref{tail->m_next}.load(std::memory_order_acquire);
+        if (next != nullptr) {
+            // хвост отстал — помогаем его передвинуть
+            m_tail.compare_exchange_strong(tail, next,
+                                           std::memory_order_release,
+                                           std::memory_order_relaxed);
+            continue;
+        }
+        if (next_ref{tail->m_next}.compare_exchange_weak(
+                next, node, std::memory_order_release,
+                std::memory_order_relaxed)) {
+            m_tail.compare_exchange_strong(tail, node,
+                                           std::memory_order_release,
+                                           std::memory_order_relaxed);
+            break;
+        }
+    }
+    record.hazards[0].store(nullptr, std::memory_order_release);
+}
+
+template <typename T, typename Allocator>
+typename MyConcurrentQueueTypeContainer<T, Allocator>::node_base_type*
+MyConcurrentQueueTypeContainer<T, Allocator>::protect(
+    HazardDomain::Record& record, std::size_t slot,
+    const std::atomic<node_base_type*>& src) {
+    node_base_type* ptr = src.load(std::memory_order_relaxed);
+    while (true) {
+        // seq_cst: публикация должна быть видна до повторного чтения
+        record.hazards[slot].store(ptr);
+        node_base_type* current = src.load();
+        if (current == ptr) {
+            return ptr;
+        }
+        ptr = current;
+    }
+}
+
+template <typename T, typename Allocator>
+typename MyConcurrentQueueTypeContainer<T, Allocator>::node_type*
+MyConcurrentQueueTypeContainer<T, Allocator>::unlinkHead(
+    HazardDomain::Record& record) {
+    while (true) {
+        node_base_type* head = protect(record, 0, m_head);
+        node_type* next =
+            next_ref{head->m_next}.load(std::memory_order_acquire);
+        record.hazards[1].store(next);
+        // голова не сменилась — next ещё в очереди и защищён
+        if (head != m_head.load()) {
+            continue;
+        }
+        if (next == nullptr) {
+            record.hazards[0].store(nullptr, std::memory_order_release);
+            record.hazards[1].store(nullptr, std::memory_order_release);
+            return nullptr;
+        }
+        node_base_type* tail = m_tail.load(std::memory_order_acquire);
+        if (head == tail) {
+            // хвост отстал — помогаем его передвинуть
+            m_tail.compare_exchange_strong(tail, next,
+                                           std::memory_order_release,
+                                           std::memory_order_relaxed);
+            continue;
+        }
+        if (m_head.compare_exchange_strong(head, next,
+                                           std::memory_order_acq_rel,
+                                           std::memory_order_relaxed)) {
+            return next;
+        }
+    }
+}
+
+template <typename T, typename Allocator>
+void MyConcurrentQueueTypeContainer<T, Allocator>::retireHead(
+    HazardDomain::Record& record) {
+    auto* head = static_cast<node_base_type*>(
+        record.hazards[0].load(std::memory_order_relaxed));
+    record.hazards[0].store(nullptr, std::memory_order_release);
+    record.hazards[1].store(nullptr, std::memory_order_release);
+    if (head == &m_stub) {
+        return;
+    }
+    m_hazards->retire(record, head, [this](void* ptr) { reclaim(ptr); });
+}
+
+template <typename T, typename Allocator>
+void MyConcurrentQueueTypeContainer<T, Allocator>::reclaim(void* ptr) {
+    destroyNode(static_cast<node_type*>(static_cast<node_base_type*>(ptr)));
+}
@@ -0,0 +1,492 @@
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "slot_pool.hpp"
+
+// Узел списка с индексной ссылкой: m_next — номер следующего узла в блоке
+// пула, а не указатель. Для MyIndexedNode<int, uint16_t/uint32_t> это
+// 8 байт вместо 16 у MyUniDirNode<int>.
+template <typename T, typename Index>
+struct MyIndexedNode {
+    T* data() noexcept {
+        return std::launder(reinterpret_cast<T*>(m_storage));
+    }
+    const T* data() const noexcept {
+        return std::launder(reinterpret_cast<const T*>(m_storage));
+    }
+
+    alignas(T) unsigned char m_storage[sizeof(T)];  // элемент занятого узла
+    Index m_next;  // следующий узел списка или свободный узел
+};
+
+// Однонаправленный список на ограниченном пуле из N узлов. Все узлы —
+// один блок, полученный от аллокатора одним запросом allocate(N) при
+// первой вставке; ссылки — номера узлов в блоке, их ширина выбирается
+// на этапе компиляции по N (slot_index_t). Ссылки не зависят от адреса
+// блока, поэтому структура перемещаема.
+// API совпадает с MyUniDirListTypeContainer; при переполнении пула —
+// std::bad_alloc, как у FixedAllocator с GrowthPolicy::Fixed.
+template <typename T, std::size_t N, typename Allocator = std::allocator<T>>
+class MyIndexedListTypeContainer {
+    static_assert(N > 0, "MyIndexedListTypeContainer: N must be positive");
+    static_assert(N < std::numeric_limits<std::uint32_t>::max(),
+                  "MyIndexedListTypeContainer: N does not fit 32-bit index");
+public:
+    MyIndexedListTypeContainer() = default;
+    explicit MyIndexedListTypeContainer(const Allocator& alloc);
+    MyIndexedListTypeContainer(const MyIndexedListTypeContainer& mlc);
+    MyIndexedListTypeContainer(MyIndexedListTypeContainer&& mlc) noexcept;
+    ~MyIndexedListTypeContainer();
+    MyIndexedListTypeContainer& operator=(
+        const MyIndexedListTypeContainer& mlc);
+    MyIndexedListTypeContainer& operator=(MyIndexedListTypeContainer&& mlc);
+    void push_back(const T& value);
+    void push_back(T&& value);
+    void push_front(const T& value);
+    void push_front(T&& value);
+    template <typename... Args>
+    T& emplace_back(Args&&... args);
+    template <typename... Args>
+    T& emplace_front(Args&&... args);
+    int insert(const T& value, size_t index);
+    int insert(T&& value, size_t index);
+    int erase(size_t first, size_t last);
+    int erase(size_t index);
+    size_t size() const;
+    const T& operator[](size_t index) const;
+    T& operator[](size_t index);
+    void clear();
+    bool empty() const;
+    Allocator get_allocator() const;
+
+    using value_type = T;
+    using allocator_type = Allocator;
+    using size_type = std::size_t;
+
+    using index_type = slot_index_t<N>;
+    using node_type = MyIndexedNode<T, index_type>;
+    using node_allocator_type = typename std::allocator_traits<
+        allocator_type>::template rebind_alloc<node_type>;
+    using node_allocator_traits = std::allocator_traits<node_allocator_type>;
+
+    static constexpr std::size_t capacity = N;
+    // Номер «нет узла»
+    static constexpr index_type npos = std::numeric_limits<index_type>::max();
+
+    // Итератор: блок узлов + номер узла (ForwardIterator)
+    template <bool IsConst>
+    class basic_iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<IsConst, const T*, T*>;
+        using reference = std::conditional_t<IsConst, const T&, T&>;
+        using node_pointer =
+            std::conditional_t<IsConst, const node_type*, node_type*>;
+
+        basic_iterator(node_pointer nodes = nullptr,
+                       index_type index = npos) noexcept
+            : m_nodes(nodes), m_index(index) {
+        }
+        // iterator -> const_iterator
+        template <bool OtherConst,
+                  typename = std::enable_if_t<IsConst && !OtherConst>>
+        basic_iterator(const basic_iterator<OtherConst>& it) noexcept
+            : m_nodes(it.m_nodes), m_index(it.m_index) {
+        }
+        reference operator*() const noexcept {
+            return *m_nodes[m_index].data();
+        }
+        pointer operator->() const noexcept {
+            return m_nodes[m_index].data();
+        }
+        basic_iterator& operator++() noexcept {
+            m_index = m_nodes[m_index].m_next;
+            return *this;
+        }
+        basic_iterator operator++(int) noexcept {
+            basic_iterator temp = *this;
+            ++*this;
+            return temp;
+        }
+        // Конец списка — npos при любом блоке
+        bool operator==(const basic_iterator& other) const noexcept {
+            return m_index == other.m_index &&
+                   (m_index == npos || m_nodes == other.m_nodes);
+        }
+        bool operator!=(const basic_iterator& other) const noexcept {
+            return !(*this == other);
+        }
+    private:
+        template <bool>
+        friend class basic_iterator;
+
+        node_pointer m_nodes;
+        index_type m_index;
+    };
+
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    iterator begin() noexcept {
+        return iterator(m_nodes, m_head);
+    }
+    iterator end() noexcept {
+        return iterator(m_nodes, npos);
+    }
+    const_iterator begin() const noexcept {
+        return const_iterator(m_nodes, m_head);
+    }
+    const_iterator end() const noexcept {
+        return const_iterator(m_nodes, npos);
+    }
+    const_iterator cbegin() const noexcept {
+        return const_iterator(m_nodes, m_head);
+    }
+    const_iterator cend() const noexcept {
+        return const_iterator(m_nodes, npos);
+    }
+private:
+    node_type* m_nodes{nullptr};  // блок из N узлов
+    index_type m_head{npos};
+    index_type m_tail{npos};
+    index_type m_free{npos};  // список освобождённых узлов
+    size_type m_used{0};      // узлы [m_used, N) ещё ни разу не выдавались
+    size_type m_size{0};
+    node_allocator_type m_node_allocator{};
+
+    void free_up_memory();
+    void copy_from(const MyIndexedListTypeContainer& mlc);
+    // Занять узел и сконструировать в нём элемент
+    template <typename... Args>
+    index_type createNode(Args&&... args);
+    // Разрушить элемент и вернуть узел в список свободных
+    void destroyNode(index_type index) noexcept;
+    void linkBack(index_type index) noexcept;
+    void linkFront(index_type index) noexcept;
+    void linkAt(index_type index, size_t position) noexcept;
+    // Номер узла с элементом position
+    index_type locate(size_t position) const noexcept;
+};
+
+template <typename T, std::size_t N, typename Allocator>
+MyIndexedListTypeContainer<T, N, Allocator>::MyIndexedListTypeContainer(
+    const Allocator& alloc)
+    : m_node_allocator(alloc) {
+}
+
+template <typename T, std::size_t N, typename Allocator>
+MyIndexedListTypeContainer<T, N, Allocator>::MyIndexedListTypeContainer(
+    const MyIndexedListTypeContainer& mlc)
+    : m_node_allocator(
+          node_allocator_traits::select_on_container_copy_construction(
+              mlc.m_node_allocator)) {
+    copy_from(mlc);
+}
+
+template <typename T, std::size_t N, typename Allocator>
+MyIndexedListTypeContainer<T, N, Allocator>::MyIndexedListTypeContainer(
+    MyIndexedListTypeContainer&& mlc) noexcept
+    : m_nodes(mlc.m_nodes),
+      m_head(mlc.m_head),
+      m_tail(mlc.m_tail),
+      m_free(mlc.m_free),
+      m_used(mlc.m_used),
+      m_size(mlc.m_size),
+      m_node_allocator(std::move(mlc.m_node_allocator)) {
+    mlc.m_nodes = nullptr;
+    mlc.m_head = mlc.m_tail = mlc.m_free = npos;
+    mlc.m_used = 0;
+    mlc.m_size = 0;
+}
+
+template <typename T, std::size_t N, typename Allocator>
+MyIndexedListTypeContainer<T, N, Allocator>::~MyIndexedListTypeContainer() {
+    free_up_memory();
+}
+
+template <typename T, std::size_t N, typename Allocator>
+MyIndexedListTypeContainer<T, N, Allocator>&
+MyIndexedListTypeContainer<T, N, Allocator>::operator=(
+    const MyIndexedListTypeContainer& mlc) {
+    if (this != &mlc) {
+        clear();
+        copy_from(mlc);
+    }
+    return *this;
+}
+
+template <typename T, std::size_t N, typename Allocator>
+MyIndexedListTypeContainer<T, N, Allocator>&
+MyIndexedListTypeContainer<T, N, Allocator>::operator=(
+    MyIndexedListTypeContainer&& mlc) {
+    if (this == &mlc) {
+        return *this;
+    }
+    if constexpr (!node_allocator_traits::
+                      propagate_on_container_move_assignment::value) {
+        // блок из чужого ресурса забрать нельзя — переносим поэлементно
+        if (m_node_allocator != mlc.m_node_allocator) {
+            clear();
+            for (auto& value : mlc) {
+                push_back(std::move(value));
+            }
+            mlc.clear();
+            return *this;
+        }
+    }
+    free_up_memory();
+    m_nodes = mlc.m_nodes;
+    m_head = mlc.m_head;
+    m_tail = mlc.m_tail;
+    m_free = mlc.m_free;
+    m_used = mlc.m_used;
+    m_size = mlc.m_size;
+    if constexpr (node_allocator_traits::
+                      propagate_on_container_move_assignment::value) {
+        m_node_allocator = std::move(mlc.m_node_allocator);
+    }
+    mlc.m_nodes = nullptr;
+    mlc.m_head = mlc.m_tail = mlc.m_free = npos;
+    mlc.m_used = 0;
+    mlc.m_size = 0;
+    return *this;
+}
+
+template <typename T, std::size_t N, typename Allocator>
+void MyIndexedListTypeContainer<T, N, Allocator>::push_back(const T& value) {
+    linkBack(createNode(value));
+}
+
+template <typename T, std::size_t N, typename Allocator>
+void MyIndexedListTypeContainer<T, N, Allocator>::push_back(T&& value) {
+    linkBack(createNode(std::move(value)));
+}
+
+template <typename T, std::size_t N, typename Allocator>
+void MyIndexedListTypeContainer<T, N, Allocator>::push_front(const T& value) {
+    linkFront(createNode(value));
+}
+
+template <typename T, std::size_t N, typename Allocator>
+void MyIndexedListTypeContainer<T, N, Allocator>::push_front(T&& value) {
+    linkFront(createNode(std::move(value)));
+}
+
+template <typename T, std::size_t N, typename Allocator>
+template <typename... Args>
+T& MyIndexedListTypeContainer<T, N, Allocator>::emplace_back(
+    Args&&... args) {
+    const index_type index = createNode(std::forward<Args>(args)...);
+    linkBack(index);
+    return *m_nodes[index].data();
+}
+
+template <typename T, std::size_t N, typename Allocator>
+template <typename... Args>
+T& MyIndexedListTypeContainer<T, N, Allocator>::emplace_front(
+    Args&&... args) {
+    const index_type index = createNode(std::forward<Args>(args)...);
+    linkFront(index);
+    return *m_nodes[index].data();
+}
+
+template <typename T, std::size_t N, typename Allocator>
+int MyIndexedListTypeContainer<T, N, Allocator>::insert(const T& value,
+                                                       size_t index) {
+    if (index >= m_size && !(index == 0 && m_size == 0)) {
+        return -1;
+    }
+    linkAt(createNode(value), index);
+    return 0;
+}
+
+template <typename T, std::size_t N, typename Allocator>
+int MyIndexedListTypeContainer<T, N, Allocator>::insert(T&& value,
+                                                       size_t index) {
+    if (index >= m_size && !(index == 0 && m_size == 0)) {
+        return -1;
+    }
+    linkAt(createNode(std::move(value)), index);
+    return 0;
+}
+
+template <typename T, std::size_t N, typename Allocator>
+int MyIndexedListTypeContainer<T, N, Allocator>::erase(size_t index) {
+    return erase(index, index);
+}
+
+template <typename T, std::size_t N, typename Allocator>
+int MyIndexedListTypeContainer<T, N, Allocator>::erase(size_t first,
+                                                      size_t last) {
+    if (first >= m_size || last >= m_size || first > last) {
+        return -1;
+    }
+    const index_type prev = first == 0 ? npos : locate(first - 1);
+    index_type current = prev == npos ? m_head : m_nodes[prev].m_next;
+    for (size_t i = first; i <= last; ++i) {
+        const index_type next = m_nodes[current].m_next;
+        destroyNode(current);
+        current = next;
+    }
+    if (prev == npos) {
+        m_head = current;
+    } else {
+        m_nodes[prev].m_next = current;
+    }
+    if (current == npos) {
+        m_tail = prev;
+    }
+    m_size -= last - first + 1;
+    return 0;
+}
+
+template <typename T, std::size_t N, typename Allocator>
+size_t MyIndexedListTypeContainer<T, N, Allocator>::size() const {
+    return m_size;
+}
+
+template <typename T, std::size_t N, typename Allocator>
+const T& MyIndexedListTypeContainer<T, N, Allocator>::operator[](
+    size_t index) const {
+    return *m_nodes[locate(index)].data();
+}
+
+template <typename T, std::size_t N, typename Allocator>
+T& MyIndexedListTypeContainer<T, N, Allocator>::operator[](size_t index) {
+    return *m_nodes[locate(index)].data();
+}
+
+// Элементы разрушаются, блок остаётся: все N узлов снова свободны
+template <typename T, std::size_t N, typename Allocator>
+void MyIndexedListTypeContainer<T, N, Allocator>::clear() {
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+        for (index_type index = m_head; index != npos;
+             index = m_nodes[index].m_next) {
+            node_allocator_traits::destroy(m_node_allocator,
+                                           m_nodes[index].data());
+        }
+    }
+    m_head = m_tail = m_free = npos;
+    m_used = 0;
+    m_size = 0;
+}
+
+template <typename T, std::size_t N, typename Allocator>
+bool MyIndexedListTypeContainer<T, N, Allocator>::empty() const {
+    return m_size == 0;
+}
+
+template <typename T, std::size_t N, typename Allocator>
+Allocator MyIndexedListTypeContainer<T, N, Allocator>::get_allocator() const {
+    return Allocator(m_node_allocator);
+}
+
+template <typename T, std::size_t N, typename Allocator>
+void MyIndexedListTypeContainer<T, N, Allocator>::free_up_memory() {
+    clear();
+    if (m_nodes != nullptr) {
+        node_allocator_traits::deallocate(m_node_allocator, m_nodes, N);
+        m_nodes = nullptr;
+    }
+}
+
+template <typename T, std::size_t N, typename Allocator>
+void MyIndexedListTypeContainer<T, N, Allocator>::copy_from(
+    const MyIndexedListTypeContainer& mlc) {
+    for (const auto& value : mlc) {
+        push_back(value);
+    }
+}
+
+template <typename T, std::size_t N, typename Allocator>
+template <typename... Args>
+typename MyIndexedListTypeContainer<T, N, Allocator>::index_type
+MyIndexedListTypeContainer<T, N, Allocator>::createNode(Args&&... args) {
+    if (m_nodes == nullptr) {
+        m_nodes = node_allocator_traits::allocate(m_node_allocator, N);
+    }
+    index_type index;
+    if (m_free != npos) {
+        index = m_free;
+        m_free = m_nodes[index].m_next;
+    } else if (m_used < N) {
+        index = static_cast<index_type>(m_used++);
+    } else {
+        throw std::bad_alloc();
+    }
+    try {
+        node_allocator_traits::construct(m_node_allocator,
+                                         m_nodes[index].data(),
+                                         std::forward<Args>(args)...);
+    } catch (...) {
+        m_nodes[index].m_next = m_free;
+        m_free = index;
+        throw;
+    }
+    m_nodes[index].m_next = npos;
+    return index;
+}
+
+template <typename T, std::size_t N, typename Allocator>
+void MyIndexedListTypeContainer<T, N, Allocator>::destroyNode(
+    index_type index) noexcept {
+    node_allocator_traits::destroy(m_node_allocator, m_nodes[index].data());
+    m_nodes[index].m_next = m_free;
+    m_free = index;
+}
+
+template <typename T, std::size_t N, typename Allocator>
+void MyIndexedListTypeContainer<T, N, Allocator>::linkBack(
+    index_type index) noexcept {
+    if (m_tail == npos) {
+        m_head = index;
+    } else {
+        m_nodes[m_tail].m_next = index;
+    }
+    m_tail = index;
+    ++m_size;
+}
+
+template <typename T, std::size_t N, typename Allocator>
+void MyIndexedListTypeContainer<T, N, Allocator>::linkFront(
+    index_type index) noexcept {
+    m_nodes[index].m_next = m_head;
+    m_head = index;
+    if (m_tail == npos) {
+        m_tail = index;
+    }
+    ++m_size;
+}
+
+template <typename T, std::size_t N, typename Allocator>
+void MyIndexedListTypeContainer<T, N, Allocator>::linkAt(
+    index_type index, size_t position) noexcept {
+    if (position == 0) {
+        linkFront(index);
+        return;
+    }
+    const index_type prev = locate(position - 1);
+    m_nodes[index].m_next = m_nodes[prev].m_next;
+    m_nodes[prev].m_next = index;
+    ++m_size;
+}
+
+template <typename T, std::size_t N, typename Allocator>
+typename MyIndexedListTypeContainer<T, N, Allocator>::index_type
+MyIndexedListTypeContainer<T, N, Allocator>::locate(
+    size_t position) const noexcept {
+    index_type index = m_head;
+    for (size_t i = 0; i < position; ++i) {
+        index = m_nodes[index].m_next;
+    }
+    return index;
+}
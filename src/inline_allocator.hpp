@@ -0,0 +1,221 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <new>
+#include <ostream>
+#include <type_traits>
+
+#include "slot_pool.hpp"
+
+// Пул из N слотов по SlotSize байт, целиком лежащий внутри объекта:
+// на стеке, в статической памяти или полем другого объекта, без обращений
+// к куче. Номера слотов — slot_index_t<N> (uint8/uint16/uint32), ссылка
+// free‑list хранится в самом свободном слоте, ни разу не выданные слоты
+// раздаются счётчиком. Пул не копируется и не перемещается: выданные
+// адреса указывают внутрь него.
+template <std::size_t N, std::size_t SlotSize,
+          std::size_t SlotAlign = alignof(std::max_align_t)>
+class InlineSlotPool {
+    static_assert(N > 0, "InlineSlotPool: N must be greater than zero");
+    static_assert((SlotAlign & (SlotAlign - 1)) == 0,
+                  "InlineSlotPool: SlotAlign must be a power of two");
+public:
+    using index_type = slot_index_t<N>;
+
+    // «Нет слота» — конец free‑list
+    static constexpr index_type npos = std::numeric_limits<index_type>::max();
+
+    // Размер слота: вмещает номер следующего свободного слота и кратен
+    // выравниванию, чтобы слоты шли вплотную
+    static constexpr std::size_t slot_size =
+        ((SlotSize < sizeof(index_type) ? sizeof(index_type) : SlotSize) +
+         SlotAlign - 1) /
+        SlotAlign * SlotAlign;
+    static constexpr std::size_t slot_align = SlotAlign;
+    static constexpr std::size_t capacity = N;
+
+    // Подходит ли пул для объектов данного размера/выравнивания
+    static constexpr bool serves(std::size_t bytes,
+                                 std::size_t align) noexcept {
+        return bytes <= slot_size && align <= slot_align;
+    }
+
+    // Память слотов не инициализируется: пустой пул на стеке ничего
+    // не стоит независимо от N
+    constexpr InlineSlotPool() noexcept {
+    }
+    InlineSlotPool(const InlineSlotPool&) = delete;
+    InlineSlotPool& operator=(const InlineSlotPool&) = delete;
+    ~InlineSlotPool() = default;
+
+    // Выделение одного слота; при переполнении std::bad_alloc
+    [[nodiscard]]
+    void* allocate() {
+        index_type index = m_free;
+        if (index != npos) {
+            // Повторное использование освобождённого слота
+            std::memcpy(&m_free, slot(index), sizeof(index_type));
+        } else if (m_used < N) {
+            index = m_used++;
+        } else {
+            recordFailure();
+            throw std::bad_alloc();
+        }
+        ++m_allocated_count;
+        recordAllocate();
+        return slot(index);
+    }
+
+    // Вернуть слот в free‑list
+    void deallocate(void* ptr) noexcept {
+        const auto index = static_cast<index_type>(
+            static_cast<std::size_t>(static_cast<unsigned char*>(ptr) -
+                                     m_storage) /
+            slot_size);
+        std::memcpy(ptr, &m_free, sizeof(index_type));
+        m_free = index;
+        --m_allocated_count;
+        recordDeallocate();
+    }
+
+    // Принадлежит ли адрес пулу — O(1)
+    [[nodiscard]]
+    bool owns(const void* ptr) const noexcept {
+        const auto* address = static_cast<const unsigned char*>(ptr);
+        return !std::less<const unsigned char*>{}(address, m_storage) &&
+               std::less<const unsigned char*>{}(address,
+                                                 m_storage + sizeof(m_storage));
+    }
+
+    // Снимок статистики в формате SlotPool; счётчики операций заполняются
+    // только при сборке с ALLOCATOR_STATS
+    [[nodiscard]]
+    SlotPoolStats stats() const noexcept {
+#ifdef ALLOCATOR_STATS
+        SlotPoolStats result = m_stats;
+#else
+        SlotPoolStats result;
+#endif
+        result.slot_size = slot_size;
+        result.live = m_allocated_count;
+        result.capacity = N;
+        return result;
+    }
+
+    [[nodiscard]]
+    constexpr std::size_t allocated_count() const noexcept {
+        return m_allocated_count;
+    }
+private:
+    unsigned char* slot(index_type index) noexcept {
+        return m_storage + static_cast<std::size_t>(index) * slot_size;
+    }
+
+    // Учёт статистики — пустые функции без ALLOCATOR_STATS
+    void recordAllocate() noexcept {
+#ifdef ALLOCATOR_STATS
+        ++m_stats.allocations;
+        if (m_allocated_count > m_stats.peak_live) {
+            m_stats.peak_live = m_allocated_count;
+        }
+#endif
+    }
+
+    void recordDeallocate() noexcept {
+#ifdef ALLOCATOR_STATS
+        ++m_stats.deallocations;
+#endif
+    }
+
+    void recordFailure() noexcept {
+#ifdef ALLOCATOR_STATS
+        ++m_stats.failed;
+#endif
+    }
+
+    alignas(SlotAlign) unsigned char m_storage[N * slot_size];
+    index_type m_free{npos};  // Голова free‑list
+    index_type m_used{0};     // Слотов, выданных хотя бы раз
+    std::size_t m_allocated_count{0};
+#ifdef ALLOCATOR_STATS
+    SlotPoolStats m_stats{};
+#endif
+};
+
+// Аллокатор-ссылка на InlineSlotPool: пул объявляется рядом с контейнером
+// (на стеке или статически), все копии и rebind-версии работают с ним,
+// поэтому небольшие map и списки обходятся без кучи. Размер слота
+// задаётся с запасом под узел контейнера — узел крупнее отвергается при
+// компиляции. Выделяются только одиночные объекты.
+template <typename T, std::size_t N, std::size_t SlotSize = 64>
+class InlineAllocator {
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+    using pool_type = InlineSlotPool<N, SlotSize>;
+
+    // Пул не принадлежит аллокатору, поэтому ссылку на него можно
+    // передавать при любых операциях контейнера
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    using is_always_equal = std::false_type;
+
+    // rebind для STL-совместимости
+    template <class U>
+    struct rebind {
+        using other = InlineAllocator<U, N, SlotSize>;
+    };
+
+    explicit InlineAllocator(pool_type& pool) noexcept : pool{&pool} {
+    }
+    template <class U>
+    InlineAllocator(const InlineAllocator<U, N, SlotSize>& other) noexcept
+        : pool{other.pool} {
+    }
+
+    [[nodiscard]]
+    auto allocate(size_type count) -> T* {
+        static_assert(pool_type::serves(sizeof(T), alignof(T)),
+                      "InlineAllocator: SlotSize is too small for the node");
+        if (count != 1) {
+            throw std::bad_alloc();
+        }
+        return static_cast<T*>(pool->allocate());
+    }
+
+    void deallocate(T* ptr, size_type count) noexcept {
+        if (!ptr || count == 0) {
+            return;
+        }
+        pool->deallocate(ptr);
+    }
+
+    [[nodiscard]]
+    auto max_size() const noexcept -> size_type {
+        return N;
+    }
+
+    // Вывести статистику пула
+    void dumpStats(std::ostream& os) const {
+        os << pool->stats() << "\n";
+    }
+
+    template <typename U, std::size_t M, std::size_t S>
+    friend class InlineAllocator;
+
+    // Аллокаторы равны, если ссылаются на один пул
+    template <typename U>
+    auto operator==(const InlineAllocator<U, N, SlotSize>& other) const noexcept
+        -> bool {
+        return pool == other.pool;
+    }
+private:
+    pool_type* pool;
+};
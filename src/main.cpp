@@ -7,6 +7,7 @@
 
 #include "allocator.hpp"
 #include "unidir_list-type_container.hpp"
+#include "workload.hpp"
 
 // Тип ключа и значения
 using KeyType = int;
@@ -70,7 +71,12 @@ void printMyContainerIt(const T& my_container) {
     std::cout << "\n";
 }
 
-int main() {
+// Без аргументов — демонстрация из задания, с аргументами —
+// нагрузочный драйвер (см. workload.hpp, --help)
+int main(int argc, char* argv[]) {
+    if (argc > 1) {
+        return runWorkloadDriver(argc, argv);
+    }
     try {
         StdMap std_map;
         // Заполнение 10 элементами: ключ — число от 0 до 9, значение —
@@ -111,6 +117,14 @@ int main() {
         std::cout << "\nMyListAlloc (мой контейнер с моим аллокатором):\n";
         printMyContainerIt(my_list_alloc);
 
+#ifdef ALLOCATOR_STATS
+        // Статистика пулов — в stderr, чтобы не смешивать с выводом задания
+        std::cerr << "\nMyMap pool stats:\n";
+        my_map.get_allocator().dumpStats(std::cerr);
+        std::cerr << "MyListAlloc pool stats:\n";
+        my_list_alloc.get_allocator().dumpStats(std::cerr);
+#endif
+
     } catch (const std::bad_alloc& e) {
         std::cerr << "Ошибка выделения памяти, превышено количество элементов: "
                   << e.what() << "\n";
@@ -0,0 +1,507 @@
+#pragma once
+
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include "indexed_list-type_container.hpp"
+#include "slot_pool.hpp"
+
+// Неизменная часть заголовка файла: по ней при открытии проверяется, что
+// файл создан для того же типа элемента и той же ёмкости
+struct MappedListIdentity {
+    // "OTUSMLST" в little-endian
+    static constexpr std::uint64_t magic_value = 0x54534C4D'5355544FULL;
+    static constexpr std::uint32_t current_version = 1;
+
+    std::uint64_t magic;
+    std::uint32_t version;
+    std::uint32_t index_size;  // sizeof номера узла
+    std::uint64_t value_size;
+    std::uint64_t value_align;
+    std::uint64_t node_size;
+    std::uint64_t capacity;
+
+    bool operator==(const MappedListIdentity&) const = default;
+};
+
+// Заголовок файла: идентификация, затем состояние списка и пула узлов
+template <typename Index>
+struct MappedListHeader {
+    MappedListIdentity identity;
+    Index head;
+    Index tail;
+    Index free;          // список освобождённых узлов
+    std::uint64_t used;  // узлы [used, N) ещё ни разу не выдавались
+    std::uint64_t size;
+};
+
+// Однонаправленный список на N узлах, лежащих в файле, отображённом
+// в память (mmap, MAP_SHARED). Узлы и ссылки — как у
+// MyIndexedListTypeContainer: номера узлов вместо указателей, поэтому
+// содержимое не зависит от адреса отображения. Заголовок хранит
+// состояние списка и free‑list, так что после перезапуска процесса
+// список открывается без перестроения — стоимость открытия не зависит
+// от числа элементов, страницы подгружаются при обращении.
+// Элементы хранятся побайтно, поэтому T должен быть тривиально
+// копируемым. Изменения попадают в файл силами ОС; sync() — явная точка,
+// после которой содержимое гарантированно записано. Файл открыт
+// монопольно (flock): второй экземпляр, в том числе из другого процесса,
+// получит std::system_error, пока первый не закрыт.
+template <typename T, std::size_t N>
+class MyMappedListTypeContainer {
+    static_assert(N > 0, "MyMappedListTypeContainer: N must be positive");
+    static_assert(N < std::numeric_limits<std::uint32_t>::max(),
+                  "MyMappedListTypeContainer: N does not fit 32-bit index");
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "MyMappedListTypeContainer: T must be trivially copyable");
+public:
+    // Открыть файл path или создать новый пустой список. Файл, созданием
+    // которого процесс не успел завершить (нулевой заголовок), создаётся
+    // заново. Заголовок и обе цепочки узлов проверяются до начала работы
+    // (один проход по файлу). Ошибки ОС и занятый файл —
+    // std::system_error, чужой или повреждённый файл — std::runtime_error
+    explicit MyMappedListTypeContainer(const std::string& path);
+    MyMappedListTypeContainer(const MyMappedListTypeContainer&) = delete;
+    MyMappedListTypeContainer& operator=(const MyMappedListTypeContainer&) =
+        delete;
+    MyMappedListTypeContainer(MyMappedListTypeContainer&& mlc) noexcept;
+    MyMappedListTypeContainer& operator=(
+        MyMappedListTypeContainer&& mlc) noexcept;
+    ~MyMappedListTypeContainer();
+    void push_back(const T& value);
+    void push_front(const T& value);
+    template <typename... Args>
+    T& emplace_back(Args&&... args);
+    template <typename... Args>
+    T& emplace_front(Args&&... args);
+    int insert(const T& value, size_t index);
+    int erase(size_t first, size_t last);
+    int erase(size_t index);
+    size_t size() const;
+    const T& operator[](size_t index) const;
+    T& operator[](size_t index);
+    void clear();
+    bool empty() const;
+    // Записать отображение в файл (msync)
+    void sync();
+
+    using value_type = T;
+    using size_type = std::size_t;
+
+    using index_type = slot_index_t<N>;
+    using node_type = MyIndexedNode<T, index_type>;
+    using header_type = MappedListHeader<index_type>;
+
+    static constexpr std::size_t capacity = N;
+    // Номер «нет узла»
+    static constexpr index_type npos = std::numeric_limits<index_type>::max();
+
+    // Узлы те же, что у MyIndexedListTypeContainer, — и итераторы те же
+    using iterator = typename MyIndexedListTypeContainer<T, N>::iterator;
+    using const_iterator =
+        typename MyIndexedListTypeContainer<T, N>::const_iterator;
+
+    iterator begin() noexcept {
+        return iterator(m_nodes, m_header->head);
+    }
+    iterator end() noexcept {
+        return iterator(m_nodes, npos);
+    }
+    const_iterator begin() const noexcept {
+        return const_iterator(m_nodes, m_header->head);
+    }
+    const_iterator end() const noexcept {
+        return const_iterator(m_nodes, npos);
+    }
+    const_iterator cbegin() const noexcept {
+        return const_iterator(m_nodes, m_header->head);
+    }
+    const_iterator cend() const noexcept {
+        return const_iterator(m_nodes, npos);
+    }
+private:
+    // Узлы начинаются сразу за заголовком
+    static constexpr std::size_t nodes_offset =
+        (sizeof(header_type) + alignof(node_type) - 1) / alignof(node_type) *
+        alignof(node_type);
+    static constexpr std::size_t file_bytes =
+        nodes_offset + N * sizeof(node_type);
+
+    static constexpr MappedListIdentity identity() noexcept {
+        return MappedListIdentity{MappedListIdentity::magic_value,
+                                  MappedListIdentity::current_version,
+                                  sizeof(index_type),
+                                  sizeof(T),
+                                  alignof(T),
+                                  sizeof(node_type),
+                                  N};
+    }
+
+    [[noreturn]] static void throwSystemError(const char* what);
+    // Состояние из заголовка не выводит за пределы узлов
+    static bool consistent(const header_type& header) noexcept;
+    // Цепочки списка и свободных узлов не выходят за [0, used) и имеют
+    // длины size и used - size
+    bool chainsConsistent() const noexcept;
+    void unmap() noexcept;
+
+    // Занять узел и сконструировать в нём элемент
+    template <typename... Args>
+    index_type createNode(Args&&... args);
+    // Вернуть узел в список свободных
+    void destroyNode(index_type index) noexcept;
+    void linkBack(index_type index) noexcept;
+    void linkFront(index_type index) noexcept;
+    void linkAt(index_type index, size_t position) noexcept;
+    // Номер узла с элементом position
+    index_type locate(size_t position) const noexcept;
+
+    int m_fd{-1};
+    void* m_mapping{nullptr};
+    header_type* m_header{nullptr};
+    node_type* m_nodes{nullptr};
+};
+
+template <typename T, std::size_t N>
+MyMappedListTypeContainer<T, N>::MyMappedListTypeContainer(
+    const std::string& path) {
+    m_fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (m_fd < 0) {
+        throwSystemError("MyMappedListTypeContainer: open");
+    }
+    try {
+        // Блокировка снимается закрытием дескриптора в unmap()
+        if (::flock(m_fd, LOCK_EX | LOCK_NB) != 0) {
+            throwSystemError("MyMappedListTypeContainer: flock");
+        }
+        struct stat st {};
+        if (::fstat(m_fd, &st) != 0) {
+            throwSystemError("MyMappedListTypeContainer: fstat");
+        }
+        bool created = st.st_size == 0;
+        if (created) {
+            if (::ftruncate(m_fd, static_cast<off_t>(file_bytes)) != 0) {
+                throwSystemError("MyMappedListTypeContainer: ftruncate");
+            }
+        } else {
+            // Заголовок проверяется до отображения файла
+            header_type stored{};
+            if (::pread(m_fd, &stored, sizeof(stored), 0) !=
+                static_cast<ssize_t>(sizeof(stored))) {
+                throw std::runtime_error(
+                    "MyMappedListTypeContainer: header is truncated");
+            }
+            // Сбой между ftruncate и записью заголовка оставляет нули
+            created = stored.identity == MappedListIdentity{} &&
+                      static_cast<std::size_t>(st.st_size) == file_bytes;
+            if (!created && !(stored.identity == identity())) {
+                throw std::runtime_error(
+                    "MyMappedListTypeContainer: header does not match "
+                    "element type or capacity");
+            }
+            if (static_cast<std::size_t>(st.st_size) != file_bytes) {
+                throw std::runtime_error(
+                    "MyMappedListTypeContainer: file size mismatch");
+            }
+            if (!created && !consistent(stored)) {
+                throw std::runtime_error(
+                    "MyMappedListTypeContainer: corrupted header");
+            }
+        }
+        m_mapping = ::mmap(nullptr, file_bytes, PROT_READ | PROT_WRITE,
+                           MAP_SHARED, m_fd, 0);
+        if (m_mapping == MAP_FAILED) {
+            m_mapping = nullptr;
+            throwSystemError("MyMappedListTypeContainer: mmap");
+        }
+        auto* bytes = static_cast<unsigned char*>(m_mapping);
+        m_header = std::launder(reinterpret_cast<header_type*>(bytes));
+        m_nodes = std::launder(
+            reinterpret_cast<node_type*>(bytes + nodes_offset));
+        if (created) {
+            // Идентификация — последней: пока её нет, файл считается
+            // недосозданным
+            m_header->head = m_header->tail = m_header->free = npos;
+            m_header->used = 0;
+            m_header->size = 0;
+            m_header->identity = identity();
+        } else if (!chainsConsistent()) {
+            throw std::runtime_error(
+                "MyMappedListTypeContainer: corrupted node links");
+        }
+    } catch (...) {
+        unmap();
+        throw;
+    }
+}
+
+template <typename T, std::size_t N>
+MyMappedListTypeContainer<T, N>::MyMappedListTypeContainer(
+    MyMappedListTypeContainer&& mlc) noexcept
+    : m_fd(std::exchange(mlc.m_fd, -1)),
+      m_mapping(std::exchange(mlc.m_mapping, nullptr)),
+      m_header(std::exchange(mlc.m_header, nullptr)),
+      m_nodes(std::exchange(mlc.m_nodes, nullptr)) {
+}
+
+template <typename T, std::size_t N>
+MyMappedListTypeContainer<T, N>& MyMappedListTypeContainer<T, N>::operator=(
+    MyMappedListTypeContainer&& mlc) noexcept {
+    if (this != &mlc) {
+        unmap();
+        m_fd = std::exchange(mlc.m_fd, -1);
+        m_mapping = std::exchange(mlc.m_mapping, nullptr);
+        m_header = std::exchange(mlc.m_header, nullptr);
+        m_nodes = std::exchange(mlc.m_nodes, nullptr);
+    }
+    return *this;
+}
+
+// Содержимое остаётся в файле; без sync() запись — на усмотрение ОС
+template <typename T, std::size_t N>
+MyMappedListTypeContainer<T, N>::~MyMappedListTypeContainer() {
+    unmap();
+}
+
+template <typename T, std::size_t N>
+void MyMappedListTypeContainer<T, N>::push_back(const T& value) {
+    linkBack(createNode(value));
+}
+
+template <typename T, std::size_t N>
+void MyMappedListTypeContainer<T, N>::push_front(const T& value) {
+    linkFront(createNode(value));
+}
+
+template <typename T, std::size_t N>
+template <typename... Args>
+T& MyMappedListTypeContainer<T, N>::emplace_back(Args&&... args) {
+    const index_type index = createNode(std::forward<Args>(args)...);
+    linkBack(index);
+    return *m_nodes[index].data();
+}
+
+template <typename T, std::size_t N>
+template <typename... Args>
+T& MyMappedListTypeContainer<T, N>::emplace_front(Args&&... args) {
+    const index_type index = createNode(std::forward<Args>(args)...);
+    linkFront(index);
+    return *m_nodes[index].data();
+}
+
+template <typename T, std::size_t N>
+int MyMappedListTypeContainer<T, N>::insert(const T& value, size_t index) {
+    if (index >= m_header->size && !(index == 0 && m_header->size == 0)) {
+        return -1;
+    }
+    linkAt(createNode(value), index);
+    return 0;
+}
+
+template <typename T, std::size_t N>
+int MyMappedListTypeContainer<T, N>::erase(size_t index) {
+    return erase(index, index);
+}
+
+template <typename T, std::size_t N>
+int MyMappedListTypeContainer<T, N>::erase(size_t first, size_t last) {
+    if (first >= m_header->size || last >= m_header->size || first > last) {
+        return -1;
+    }
+    const index_type prev = first == 0 ? npos : locate(first - 1);
+    index_type current = prev == npos ? m_header->head : m_nodes[prev].m_next;
+    for (size_t i = first; i <= last; ++i) {
+        const index_type next = m_nodes[current].m_next;
+        destroyNode(current);
+        current = next;
+    }
+    if (prev == npos) {
+        m_header->head = current;
+    } else {
+        m_nodes[prev].m_next = current;
+    }
+    if (current == npos) {
+        m_header->tail = prev;
+    }
+    m_header->size -= last - first + 1;
+    return 0;
+}
+
+template <typename T, std::size_t N>
+size_t MyMappedListTypeContainer<T, N>::size() const {
+    return static_cast<size_t>(m_header->size);
+}
+
+template <typename T, std::size_t N>
+const T& MyMappedListTypeContainer<T, N>::operator[](size_t index) const {
+    return *m_nodes[locate(index)].data();
+}
+
+template <typename T, std::size_t N>
+T& MyMappedListTypeContainer<T, N>::operator[](size_t index) {
+    return *m_nodes[locate(index)].data();
+}
+
+// Элементы тривиальны — достаточно сбросить состояние в заголовке
+template <typename T, std::size_t N>
+void MyMappedListTypeContainer<T, N>::clear() {
+    m_header->head = m_header->tail = m_header->free = npos;
+    m_header->used = 0;
+    m_header->size = 0;
+}
+
+template <typename T, std::size_t N>
+bool MyMappedListTypeContainer<T, N>::empty() const {
+    return m_header->size == 0;
+}
+
+template <typename T, std::size_t N>
+void MyMappedListTypeContainer<T, N>::sync() {
+    if (::msync(m_mapping, file_bytes, MS_SYNC) != 0) {
+        throwSystemError("MyMappedListTypeContainer: msync");
+    }
+}
+
+template <typename T, std::size_t N>
+void MyMappedListTypeContainer<T, N>::throwSystemError(const char* what) {
+    throw std::system_error(errno, std::generic_category(), what);
+}
+
+template <typename T, std::size_t N>
+bool MyMappedListTypeContainer<T, N>::consistent(
+    const header_type& header) noexcept {
+    // Выданные узлы — [0, used); пустой список — без головы и хвоста
+    const auto valid = [&](index_type index) {
+        return index == npos || index < header.used;
+    };
+    return header.used <= N && header.size <= header.used &&
+           valid(header.head) && valid(header.tail) && valid(header.free) &&
+           (header.size == 0) == (header.head == npos) &&
+           (header.size == 0) == (header.tail == npos);
+}
+
+template <typename T, std::size_t N>
+bool MyMappedListTypeContainer<T, N>::chainsConsistent() const noexcept {
+    // Ровно length узлов из [0, used), затем npos; цикл или ссылка за
+    // пределы выданных узлов обрывают проход. last — последний узел
+    const auto walk = [this](index_type index, std::size_t length,
+                             index_type& last) {
+        for (std::size_t count = 0; count < length; ++count) {
+            if (index == npos || index >= m_header->used) {
+                return false;
+            }
+            last = index;
+            index = m_nodes[index].m_next;
+        }
+        return index == npos;
+    };
+    index_type last = npos;
+    if (!walk(m_header->head, m_header->size, last) ||
+        last != m_header->tail) {
+        return false;
+    }
+    return walk(m_header->free, m_header->used - m_header->size, last);
+}
+
+template <typename T, std::size_t N>
+void MyMappedListTypeContainer<T, N>::unmap() noexcept {
+    if (m_mapping != nullptr) {
+        ::munmap(m_mapping, file_bytes);
+        m_mapping = nullptr;
+    }
+    if (m_fd >= 0) {
+        ::close(m_fd);
+        m_fd = -1;
+    }
+    m_header = nullptr;
+    m_nodes = nullptr;
+}
+
+template <typename T, std::size_t N>
+template <typename... Args>
+typename MyMappedListTypeContainer<T, N>::index_type
+MyMappedListTypeContainer<T, N>::createNode(Args&&... args) {
+    index_type index;
+    if (m_header->free != npos) {
+        index = m_header->free;
+        m_header->free = m_nodes[index].m_next;
+    } else if (m_header->used < N) {
+        index = static_cast<index_type>(m_header->used++);
+    } else {
+        throw std::bad_alloc();
+    }
+    try {
+        ::new (static_cast<void*>(m_nodes[index].m_storage))
+            T(std::forward<Args>(args)...);
+    } catch (...) {
+        m_nodes[index].m_next = m_header->free;
+        m_header->free = index;
+        throw;
+    }
+    m_nodes[index].m_next = npos;
+    return index;
+}
+
+template <typename T, std::size_t N>
+void MyMappedListTypeContainer<T, N>::destroyNode(index_type index) noexcept {
+    m_nodes[index].m_next = m_header->free;
+    m_header->free = index;
+}
+
+template <typename T, std::size_t N>
+void MyMappedListTypeContainer<T, N>::linkBack(index_type index) noexcept {
+    if (m_header->tail == npos) {
+        m_header->head = index;
+    } else {
+        m_nodes[m_header->tail].m_next = index;
+    }
+    m_header->tail = index;
+    ++m_header->size;
+}
+
+template <typename T, std::size_t N>
+void MyMappedListTypeContainer<T, N>::linkFront(index_type index) noexcept {
+    m_nodes[index].m_next = m_header->head;
+    m_header->head = index;
+    if (m_header->tail == npos) {
+        m_header->tail = index;
+    }
+    ++m_header->size;
+}
+
+template <typename T, std::size_t N>
+void MyMappedListTypeContainer<T, N>::linkAt(index_type index,
+                                             size_t position) noexcept {
+    if (position == 0) {
+        linkFront(index);
+        return;
+    }
+    const index_type prev = locate(position - 1);
+    m_nodes[index].m_next = m_nodes[prev].m_next;
+    m_nodes[prev].m_next = index;
+    ++m_header->size;
+}
+
+template <typename T, std::size_t N>
+typename MyMappedListTypeContainer<T, N>::index_type
+MyMappedListTypeContainer<T, N>::locate(size_t position) const noexcept {
+    index_type index = m_header->head;
+    for (size_t i = 0; i < position; ++i) {
+        index = m_nodes[index].m_next;
+    }
+    return index;
+}
@@ -0,0 +1,224 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+// Монотонная арена: память выдаётся сдвигом указателя по чанкам,
+// deallocate ничего не делает, всё освобождается разом — reset() или
+// удалением арены. Каждый следующий чанк вдвое больше предыдущего.
+class MonotonicArena {
+public:
+    explicit MonotonicArena(std::size_t initial_bytes) noexcept
+        : m_next_chunk_bytes{initial_bytes > 0 ? initial_bytes : 1} {
+    }
+    MonotonicArena(const MonotonicArena&) = delete;
+    MonotonicArena& operator=(const MonotonicArena&) = delete;
+
+    ~MonotonicArena() {
+        releaseChunks(nullptr);
+    }
+
+    void* allocate(std::size_t bytes, std::size_t align) {
+        void* ptr = m_bump;
+        std::size_t space = static_cast<std::size_t>(m_end - m_bump);
+        if (m_bump == nullptr ||
+            std::align(align, bytes, ptr, space) == nullptr) {
+            grow(bytes, align);
+            ptr = m_bump;
+            space = static_cast<std::size_t>(m_end - m_bump);
+            std::align(align, bytes, ptr, space);
+        }
+        m_bump = static_cast<unsigned char*>(ptr) + bytes;
+        return ptr;
+    }
+
+    // Освободить всё выделенное: остаётся только последний (самый большой)
+    // чанк, следующий цикл заполнения начинается с его начала
+    void reset() noexcept {
+        if (m_last_chunk == nullptr) {
+            return;
+        }
+        releaseChunks(m_last_chunk);
+        m_last_chunk->prev = nullptr;
+        m_bump = data(m_last_chunk);
+    }
+
+    void retain() noexcept {
+        ++m_ref_count;
+    }
+
+    // true — ссылок больше нет, арену нужно удалить
+    bool release() noexcept {
+        return --m_ref_count == 0;
+    }
+
+    // Арена принадлежит единственному аллокатору
+    bool exclusive() const noexcept {
+        return m_ref_count == 1;
+    }
+private:
+    struct ChunkHeader {
+        ChunkHeader* prev;  // ранее выделенный чанк
+        std::size_t bytes;  // размер области данных
+    };
+
+    static unsigned char* data(ChunkHeader* chunk) noexcept {
+        return reinterpret_cast<unsigned char*>(chunk + 1);
+    }
+
+    void grow(std::size_t bytes, std::size_t align) {
+        if (bytes > std::numeric_limits<std::size_t>::max() / 2 - align) {
+            throw std::bad_alloc();
+        }
+        const std::size_t chunk_bytes =
+            std::max(m_next_chunk_bytes, bytes + align);
+        void* raw = ::operator new(sizeof(ChunkHeader) + chunk_bytes);
+        m_last_chunk = ::new (raw) ChunkHeader{m_last_chunk, chunk_bytes};
+        m_bump = data(m_last_chunk);
+        m_end = m_bump + chunk_bytes;
+        if (chunk_bytes <= std::numeric_limits<std::size_t>::max() / 2) {
+            m_next_chunk_bytes = chunk_bytes * 2;
+        }
+    }
+
+    // Удалить все чанки, предшествующие keep (nullptr — все)
+    void releaseChunks(ChunkHeader* keep) noexcept {
+        ChunkHeader* chunk = keep != nullptr ? keep->prev : m_last_chunk;
+        while (chunk != nullptr) {
+            ChunkHeader* prev = chunk->prev;
+            ::operator delete(chunk);
+            chunk = prev;
+        }
+    }
+
+    ChunkHeader* m_last_chunk{nullptr};  // Последний выделенный чанк
+    unsigned char* m_bump{nullptr};      // Начало свободной части чанка
+    unsigned char* m_end{nullptr};       // Конец последнего чанка
+    std::size_t m_next_chunk_bytes;      // Размер следующего чанка
+    std::size_t m_ref_count{1};
+};
+
+// Аллокатор-фасад над MonotonicArena: первый чанк вмещает N объектов T,
+// копии и rebind-версии делят арену. deallocate — пустая операция,
+// поэтому контейнер, владеющий ареной единолично, может освободить все
+// узлы сразу через reset().
+template <typename T, std::size_t N>
+class MonotonicAllocator {
+    static_assert(N > 0, "MonotonicAllocator: N must be greater than zero");
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_copy_assignment = std::false_type;
+    using propagate_on_container_swap = std::false_type;
+
+    using is_always_equal = std::false_type;
+
+    // Участок из allocate(count) можно «возвращать» по одному элементу
+    using is_run_splittable = std::true_type;
+    // Все выделенные блоки освобождаются разом через reset()
+    using is_resettable = std::true_type;
+
+    // rebind для STL-совместимости
+    template <class U>
+    struct rebind {
+        using other = MonotonicAllocator<U, N>;
+    };
+
+    // Арена создаётся сразу, но без исключений (как у FixedAllocator):
+    // если памяти на неё нет, allocate бросает std::bad_alloc
+    MonotonicAllocator() noexcept
+        : arena{new (std::nothrow) MonotonicArena{N * sizeof(T)}} {
+    }
+    MonotonicAllocator(const MonotonicAllocator& other) noexcept
+        : arena{other.arena} {
+        retainArena();
+    }
+    template <class U>
+    MonotonicAllocator(const MonotonicAllocator<U, N>& other) noexcept
+        : arena{other.arena} {
+        retainArena();
+    }
+
+    auto operator=(const MonotonicAllocator& other) noexcept
+        -> MonotonicAllocator& {
+        if (arena != other.arena) {
+            if (other.arena != nullptr) {
+                other.arena->retain();
+            }
+            releaseArena();
+            arena = other.arena;
+        }
+        return *this;
+    }
+
+    ~MonotonicAllocator() {
+        releaseArena();
+    }
+
+    // Копия контейнера получает собственную арену
+    [[nodiscard]]
+    auto select_on_container_copy_construction() const -> MonotonicAllocator {
+        return MonotonicAllocator{};
+    }
+
+    [[nodiscard]]
+    auto allocate(size_type count) -> T* {
+        if (count == 0) {
+            return nullptr;
+        }
+        if (count > max_size() || arena == nullptr) {
+            throw std::bad_alloc();
+        }
+        return static_cast<T*>(arena->allocate(count * sizeof(T), alignof(T)));
+    }
+
+    // Память возвращается только через reset() или вместе с ареной
+    void deallocate(T*, size_type) noexcept {
+    }
+
+    [[nodiscard]]
+    auto max_size() const noexcept -> size_type {
+        return std::numeric_limits<size_type>::max() / sizeof(T);
+    }
+
+    // Освободить всю арену, если ею владеет только этот аллокатор.
+    // Объекты в арене должны быть уже уничтожены (или тривиальны)
+    auto reset() noexcept -> bool {
+        if (arena == nullptr || !arena->exclusive()) {
+            return false;
+        }
+        arena->reset();
+        return true;
+    }
+
+    template <typename U, std::size_t M>
+    friend class MonotonicAllocator;
+
+    // Аллокаторы равны, если разделяют одну арену
+    template <typename U>
+    auto operator==(const MonotonicAllocator<U, N>& other) const noexcept
+        -> bool {
+        return arena == other.arena;
+    }
+private:
+    void retainArena() noexcept {
+        if (arena != nullptr) {
+            arena->retain();
+        }
+    }
+
+    void releaseArena() noexcept {
+        if (arena != nullptr && arena->release()) {
+            delete arena;
+        }
+    }
+
+    MonotonicArena* arena;  // nullptr — не хватило памяти на арену
+};
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <memory_resource>
+#include <new>
+#include <ostream>
+
+#include "allocator.hpp"
+#include "slot_pool.hpp"
+
+// Пул слотов в виде std::pmr::memory_resource: размер пула и политика
+// роста задаются во время выполнения, а не параметром шаблона.
+// Блоки до largest_pool_block байт берутся из пулов слотов; размеры
+// округляются вверх до степени двойки, так что на каждый класс размера
+// (и выравнивание) заводится один пул, а растущий std::pmr::vector
+// не плодит по пулу на каждую ёмкость. Остальные блоки — и запросы
+// сверх ёмкости пула с GrowthPolicy::Fixed — уходят в upstream.
+class PoolMemoryResource : public std::pmr::memory_resource {
+public:
+    static constexpr std::size_t default_largest_pool_block = 512;
+
+    explicit PoolMemoryResource(
+        std::size_t chunk_slots, GrowthPolicy growth = GrowthPolicy::Fixed,
+        std::pmr::memory_resource* upstream = std::pmr::get_default_resource(),
+        std::size_t largest_pool_block = default_largest_pool_block)
+        : m_arena{chunk_slots == 0 ? 1 : chunk_slots, growth},
+          m_growth{growth},
+          m_upstream{upstream},
+          m_largest_pool_block{largest_pool_block} {
+    }
+    PoolMemoryResource(const PoolMemoryResource&) = delete;
+    PoolMemoryResource& operator=(const PoolMemoryResource&) = delete;
+    ~PoolMemoryResource() override = default;
+
+    [[nodiscard]]
+    std::pmr::memory_resource* upstream_resource() const noexcept {
+        return m_upstream;
+    }
+
+    // Вывести статистику пулов ресурса
+    void dumpStats(std::ostream& os) const {
+        m_arena.dumpStats(os);
+    }
+private:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+        if (bytes > m_largest_pool_block) {
+            return m_upstream->allocate(bytes, alignment);
+        }
+        SlotPool* pool = m_arena.acquire(classSize(bytes), alignment);
+        if (m_growth != GrowthPolicy::Fixed) {
+            return pool->allocate();
+        }
+        try {
+            return pool->allocate();
+        } catch (const std::bad_alloc&) {
+            // пул исчерпан — запасной путь через upstream
+            return m_upstream->allocate(bytes, alignment);
+        }
+    }
+
+    void do_deallocate(void* ptr, std::size_t bytes,
+                       std::size_t alignment) override {
+        if (bytes > m_largest_pool_block) {
+            m_upstream->deallocate(ptr, bytes, alignment);
+            return;
+        }
+        SlotPool* pool = m_arena.acquire(classSize(bytes), alignment);
+        if (m_growth != GrowthPolicy::Fixed || pool->owns(ptr)) {
+            pool->deallocate(ptr);
+        } else {
+            m_upstream->deallocate(ptr, bytes, alignment);
+        }
+    }
+
+    // Класс размера: ближайшая сверху степень двойки
+    static std::size_t classSize(std::size_t bytes) noexcept {
+        return std::bit_ceil(bytes);
+    }
+
+    [[nodiscard]]
+    bool do_is_equal(
+        const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+    FixedPoolArena m_arena;
+    GrowthPolicy m_growth;
+    std::pmr::memory_resource* m_upstream;
+    std::size_t m_largest_pool_block;
+};
@@ -0,0 +1,241 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <new>
+#include <ostream>
+#include <type_traits>
+#include <utility>
+
+#include "slot_pool.hpp"
+
+// Slab-арена: классы размеров — степени двойки от 8 до 512 байт,
+// каждый класс обслуживается своим SlotPool (тот же free‑list, что и
+// у FixedAllocator). Узлы разных типов одного класса делят память.
+// Блоки больше 512 байт или с большим выравниванием — через ::operator new.
+class SlabArena {
+public:
+    static constexpr std::size_t min_class_size = 8;
+    static constexpr std::size_t max_class_size = 512;
+    static constexpr std::size_t class_count =
+        static_cast<std::size_t>(std::bit_width(max_class_size) -
+                                 std::bit_width(min_class_size)) +
+        1;
+    static constexpr std::size_t max_class_align = alignof(std::max_align_t);
+
+    // Номер класса для блока bytes/align; class_count — не обслуживается
+    static constexpr std::size_t sizeClass(std::size_t bytes,
+                                           std::size_t align) noexcept {
+        if (bytes > max_class_size || align > max_class_align) {
+            return class_count;
+        }
+        const std::size_t size = std::bit_ceil(
+            bytes < min_class_size ? min_class_size : bytes);
+        return static_cast<std::size_t>(std::bit_width(size) -
+                                        std::bit_width(min_class_size));
+    }
+
+    static constexpr std::size_t classSize(std::size_t index) noexcept {
+        return min_class_size << index;
+    }
+
+    SlabArena(std::size_t chunk_slots, GrowthPolicy growth) noexcept
+        : m_chunk_slots{chunk_slots}, m_growth{growth} {
+    }
+    SlabArena(const SlabArena&) = delete;
+    SlabArena& operator=(const SlabArena&) = delete;
+    ~SlabArena() = default;
+
+    // Пул класса index (создаётся при первом обращении)
+    SlotPool& pool(std::size_t index) {
+        if (!m_pools[index]) {
+            const std::size_t size = classSize(index);
+            m_pools[index] = std::make_unique<SlotPool>(
+                size, size < max_class_align ? size : max_class_align,
+                m_chunk_slots, m_growth);
+        }
+        return *m_pools[index];
+    }
+
+    // Уже созданный пул класса index: путь освобождения не выделяет память
+    SlotPool& existingPool(std::size_t index) noexcept {
+        return *m_pools[index];
+    }
+
+    void* allocate(std::size_t bytes, std::size_t align) {
+        const std::size_t index = sizeClass(bytes, align);
+        if (index == class_count) {
+            return ::operator new(bytes, std::align_val_t{align});
+        }
+        return pool(index).allocate();
+    }
+
+    void deallocate(void* ptr, std::size_t bytes, std::size_t align) noexcept {
+        const std::size_t index = sizeClass(bytes, align);
+        if (index == class_count) {
+            ::operator delete(ptr, std::align_val_t{align});
+            return;
+        }
+        m_pools[index]->deallocate(ptr);
+    }
+
+    // Вывести статистику созданных классов размеров
+    void dumpStats(std::ostream& os) const {
+        for (const auto& pool : m_pools) {
+            if (pool) {
+                os << pool->stats() << "\n";
+            }
+        }
+    }
+
+    void retain() noexcept {
+        ++m_ref_count;
+    }
+
+    // true — ссылок больше нет, арену нужно удалить
+    bool release() noexcept {
+        return --m_ref_count == 0;
+    }
+private:
+    std::size_t m_chunk_slots;
+    GrowthPolicy m_growth;
+    std::array<std::unique_ptr<SlotPool>, class_count> m_pools{};
+    std::size_t m_ref_count{1};
+};
+
+// Аллокатор-фасад над SlabArena: все rebind-версии и копии делят одну
+// арену. Класс размера для одиночного объекта вычисляется на этапе
+// компиляции, для массивов — во время выполнения.
+template <typename T, std::size_t N,
+          GrowthPolicy Growth = GrowthPolicy::Geometric>
+class SlabAllocator {
+    static_assert(N > 0, "SlabAllocator: N must be greater than zero");
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_copy_assignment = std::false_type;
+    using propagate_on_container_swap = std::false_type;
+
+    using is_always_equal = std::false_type;
+
+    // Класс размера value_type (class_count — мимо slab)
+    static constexpr std::size_t size_class =
+        SlabArena::sizeClass(sizeof(T), alignof(T));
+
+    // rebind для STL-совместимости
+    template <class U>
+    struct rebind {
+        using other = SlabAllocator<U, N, Growth>;
+    };
+
+    // Как у FixedAllocator: арена (без пулов) создаётся сразу, чтобы копии
+    // делили её, не бросая исключений; без памяти аллокатор остаётся
+    // без арены и allocate бросает std::bad_alloc
+    SlabAllocator() noexcept : arena{new (std::nothrow) SlabArena{N, Growth}} {
+    }
+    SlabAllocator(const SlabAllocator& other) noexcept : arena{other.arena} {
+        retainArena();
+    }
+    template <class U>
+    SlabAllocator(const SlabAllocator<U, N, Growth>& other) noexcept
+        : arena{other.arena} {
+        retainArena();
+    }
+
+    auto operator=(const SlabAllocator& other) noexcept -> SlabAllocator& {
+        if (arena != other.arena) {
+            if (other.arena != nullptr) {
+                other.arena->retain();
+            }
+            releaseArena();
+            arena = other.arena;
+        }
+        return *this;
+    }
+
+    ~SlabAllocator() {
+        releaseArena();
+    }
+
+    [[nodiscard]]
+    auto select_on_container_copy_construction() const -> SlabAllocator {
+        return SlabAllocator{};
+    }
+
+    // Выделение памяти
+    [[nodiscard]]
+    auto allocate(size_type count) -> T* {
+        if (count == 0) {
+            return nullptr;
+        }
+        if (arena == nullptr) {
+            throw std::bad_alloc();  // арену не удалось создать
+        }
+        if constexpr (size_class != SlabArena::class_count) {
+            if (count == 1) {
+                return static_cast<T*>(arena->pool(size_class).allocate());
+            }
+        }
+        if (count > max_size()) {
+            throw std::bad_alloc();
+        }
+        return static_cast<T*>(
+            arena->allocate(count * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T* ptr, size_type count) noexcept {
+        if (!ptr || count == 0) {
+            return;
+        }
+        if constexpr (size_class != SlabArena::class_count) {
+            if (count == 1) {
+                // ptr выделен из этого класса — пул уже есть
+                arena->existingPool(size_class).deallocate(ptr);
+                return;
+            }
+        }
+        arena->deallocate(ptr, count * sizeof(T), alignof(T));
+    }
+
+    [[nodiscard]]
+    auto max_size() const noexcept -> size_type {
+        return std::numeric_limits<size_type>::max() / sizeof(T);
+    }
+
+    // Вывести статистику всей общей арены
+    void dumpStats(std::ostream& os) const {
+        if (arena != nullptr) {
+            arena->dumpStats(os);
+        }
+    }
+
+    template <typename U, std::size_t M, GrowthPolicy G>
+    friend class SlabAllocator;
+
+    // Аллокаторы равны, если разделяют одну арену
+    template <typename U>
+    auto operator==(const SlabAllocator<U, N, Growth>& other) const noexcept
+        -> bool {
+        return arena == other.arena;
+    }
+private:
+    void retainArena() noexcept {
+        if (arena != nullptr) {
+            arena->retain();
+        }
+    }
+
+    void releaseArena() noexcept {
+        if (arena != nullptr && arena->release()) {
+            delete arena;
+        }
+    }
+
+    SlabArena* arena;
+};
@@ -0,0 +1,560 @@
+#pragma once
+
+#include <sys/mman.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <ostream>
+#include <type_traits>
+
+// Политика роста пула
+enum class GrowthPolicy {
+    Fixed,      // один блок на N элементов, при переполнении std::bad_alloc
+    Linear,     // при переполнении добавляется новый чанк на N элементов
+    Geometric,  // каждый следующий чанк вдвое больше предыдущего
+};
+
+// Откуда пул берёт память под чанки
+enum class ChunkBacking {
+    Heap,       // ::operator new с выравниванием слота
+    HugePages,  // mmap с выравниванием на 2 МиБ и madvise(MADV_HUGEPAGE)
+    HugePagesPrefault,  // то же, страницы заполняются сразу при росте
+};
+
+// Самый узкий беззнаковый тип для номеров слотов пула на N слотов;
+// максимальное значение типа зарезервировано под «нет слота»
+template <std::size_t N>
+using slot_index_t = std::conditional_t<
+    (N < std::numeric_limits<std::uint8_t>::max()), std::uint8_t,
+    std::conditional_t<(N < std::numeric_limits<std::uint16_t>::max()),
+                       std::uint16_t, std::uint32_t>>;
+
+// Статистика пула слотов
+struct SlotPoolStats {
+    std::size_t slot_size{0};      // размер слота в байтах
+    std::size_t allocations{0};    // вызовов выделения
+    std::size_t deallocations{0};  // вызовов освобождения
+    std::size_t live{0};           // занято слотов сейчас
+    std::size_t peak_live{0};      // максимум занятых слотов
+    std::size_t chunks{0};         // выделено чанков
+    std::size_t capacity{0};       // слотов во всех чанках
+    std::size_t failed{0};         // отказов (std::bad_alloc)
+    std::size_t adjacent{0};  // выделений сразу за предыдущим по адресу
+};
+
+inline std::ostream& operator<<(std::ostream& os, const SlotPoolStats& stats) {
+    os << "slot_size=" << stats.slot_size << " live=" << stats.live
+       << " peak_live=" << stats.peak_live << " capacity=" << stats.capacity
+       << " chunks=" << stats.chunks << " allocations=" << stats.allocations
+       << " deallocations=" << stats.deallocations
+       << " failed=" << stats.failed << " adjacent=" << stats.adjacent;
+    if (stats.allocations > 1) {
+        os << " (" << 100 * stats.adjacent / (stats.allocations - 1) << "%)";
+    }
+    return os;
+}
+
+// Пул слотов одного размера и выравнивания — общий движок аллокаторов.
+// Свободные слоты связаны intrusive free‑list (ссылка хранится в самом
+// слоте), ни разу не выданные слоты раздаются bump-указателем.
+// Непрерывные участки (run) из нескольких слотов берутся из bump-области
+// или из списка свободных участков; этот список упорядочен по адресу,
+// соседние участки при освобождении сливаются, участок на границе
+// bump-области возвращается в неё — фрагментация остаётся ограниченной.
+class SlotPool {
+public:
+    SlotPool(std::size_t slot_size, std::size_t slot_align,
+             std::size_t chunk_slots, GrowthPolicy growth,
+             ChunkBacking backing = ChunkBacking::Heap) noexcept
+        : m_slot_size{roundUp(slot_size < sizeof(FreeSlot) ? sizeof(FreeSlot)
+                                                           : slot_size,
+                              maxAlign(slot_align))},
+          m_slot_align{maxAlign(slot_align)},
+          m_chunk_slots{chunk_slots},
+          m_growth{growth},
+          m_backing{backing} {
+    }
+    SlotPool(const SlotPool&) = delete;
+    SlotPool& operator=(const SlotPool&) = delete;
+
+    ~SlotPool() {
+        // Освобождаем память при уничтожении пула
+        while (m_last_chunk != nullptr) {
+            ChunkHeader* prev = m_last_chunk->prev;
+            releaseChunk(m_last_chunk);
+            m_last_chunk = prev;
+        }
+    }
+
+    // Выделение одного слота
+    [[nodiscard]]
+    void* allocate() {
+        FreeSlot* slot = m_free_head;
+        if (slot != nullptr) {
+            // Повторное использование освобождённого слота
+            m_free_head = slot->next;  // сдвиг головы списка
+            ++m_allocated_count;
+            recordAllocate(slot, 1);
+            return slot;
+        }
+        return allocate(1);
+    }
+
+    // Выделение count подряд идущих слотов
+    [[nodiscard]]
+    void* allocate(std::size_t count) {
+        if (count == 1 && m_free_head != nullptr) {
+            return allocate();
+        }
+        // Слоты, которые ещё ни разу не выдавались, — по bump-указателю,
+        // затем свободные участки, затем новый чанк
+        if (bumpSlots() < count) {
+            void* run = takeRun(count);
+            if (run == nullptr && count > 1 && m_unsorted_slots != 0) {
+                // одиночные свободные слоты могли сложиться в участок
+                absorbFreeSlots();
+                run = bumpSlots() < count ? takeRun(count) : nullptr;
+            }
+            if (run != nullptr) {
+                m_allocated_count += count;
+                recordAllocate(run, count);
+                return run;
+            }
+            if (bumpSlots() < count) {
+                try {
+                    grow(count);  // для GrowthPolicy::Fixed бросает bad_alloc
+                } catch (...) {
+                    recordFailure();
+                    throw;
+                }
+            }
+        }
+        void* result = m_bump;
+        m_bump += count * m_slot_size;
+        m_allocated_count += count;
+        recordAllocate(result, count);
+        return result;
+    }
+
+    // Слот вернуть во free‑list, память освобождается только в деструкторе
+    void deallocate(void* ptr) noexcept {
+        auto* slot = ::new (ptr) FreeSlot{m_free_head};
+        m_free_head = slot;
+        ++m_unsorted_slots;
+        if (m_allocated_count > 0) {
+            --m_allocated_count;
+        }
+        recordDeallocate(1);
+    }
+
+    // Вернуть count подряд идущих слотов
+    void deallocate(void* ptr, std::size_t count) noexcept {
+        if (count == 1) {
+            deallocate(ptr);
+            return;
+        }
+        releaseRun(static_cast<unsigned char*>(ptr), count);
+        m_allocated_count =
+            m_allocated_count > count ? m_allocated_count - count : 0;
+        recordDeallocate(count);
+    }
+
+    // Подходит ли пул для объектов данного размера/выравнивания
+    [[nodiscard]]
+    bool serves(std::size_t slot_size, std::size_t slot_align) const noexcept {
+        return m_slot_size == roundUp(slot_size < sizeof(FreeSlot)
+                                          ? sizeof(FreeSlot)
+                                          : slot_size,
+                                      maxAlign(slot_align)) &&
+               m_slot_align == maxAlign(slot_align);
+    }
+
+    // Максимальное число слотов, которое может выдать пул
+    [[nodiscard]]
+    std::size_t max_slots() const noexcept {
+        if (m_growth == GrowthPolicy::Fixed) {
+            return m_chunk_slots;
+        }
+        return std::numeric_limits<std::size_t>::max() / m_slot_size;
+    }
+
+    // Принадлежит ли адрес одному из чанков пула — O(число чанков)
+    [[nodiscard]]
+    bool owns(const void* ptr) const noexcept {
+        const auto address = reinterpret_cast<std::uintptr_t>(ptr);
+        for (const ChunkHeader* chunk = m_last_chunk; chunk != nullptr;
+             chunk = chunk->prev) {
+            const auto begin =
+                reinterpret_cast<std::uintptr_t>(chunk) + headerSize();
+            if (address >= begin && address < begin + chunk->slots * m_slot_size) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Снимок статистики; счётчики операций заполняются только при сборке
+    // с ALLOCATOR_STATS, размеры пула — всегда
+    [[nodiscard]]
+    SlotPoolStats stats() const noexcept {
+#ifdef ALLOCATOR_STATS
+        SlotPoolStats result = m_stats;
+#else
+        SlotPoolStats result;
+#endif
+        result.slot_size = m_slot_size;
+        result.live = m_allocated_count;
+        result.chunks = m_chunk_count;
+        result.capacity = m_capacity;
+        return result;
+    }
+
+    [[nodiscard]]
+    std::size_t allocated_count() const noexcept {
+        return m_allocated_count;
+    }
+
+    [[nodiscard]]
+    std::size_t slot_size() const noexcept {
+        return m_slot_size;
+    }
+
+private:
+    struct FreeSlot {
+        FreeSlot* next;
+    };
+
+    // Заголовок свободного участка из count >= 2 слотов
+    // (занимает не больше двух слотов, т.к. слот не меньше указателя)
+    struct FreeRun {
+        FreeRun* next;       // следующий участок по возрастанию адреса
+        std::size_t length;  // длина участка в слотах
+    };
+
+    // Заголовок чанка, слоты идут сразу за ним
+    struct ChunkHeader {
+        ChunkHeader* prev;          // ранее выделенный чанк
+        std::size_t slots;          // ёмкость чанка в слотах
+        std::size_t mapped_bytes;   // размер отображения; 0 — чанк из кучи
+    };
+
+    // Размер огромной страницы (THP на x86-64 и arm64 с 4K-страницами)
+    static constexpr std::size_t huge_page_size = std::size_t{2} << 20U;
+    // Шаг предзаполнения — обычная страница
+    static constexpr std::size_t page_size = 4096;
+
+    static constexpr std::size_t maxAlign(std::size_t align) noexcept {
+        return align < alignof(FreeSlot) ? alignof(FreeSlot) : align;
+    }
+
+    static constexpr std::size_t roundUp(std::size_t value,
+                                         std::size_t align) noexcept {
+        return (value + align - 1) / align * align;
+    }
+
+    std::align_val_t chunkAlignment() const noexcept {
+        return static_cast<std::align_val_t>(
+            maxAlign(m_slot_align < alignof(ChunkHeader) ? alignof(ChunkHeader)
+                                                         : m_slot_align));
+    }
+
+    // Смещение первого слота от начала чанка
+    std::size_t headerSize() const noexcept {
+        return roundUp(sizeof(ChunkHeader), m_slot_align);
+    }
+
+    // Учёт статистики — пустые функции без ALLOCATOR_STATS
+    void recordAllocate([[maybe_unused]] const void* ptr,
+                        [[maybe_unused]] std::size_t count) noexcept {
+#ifdef ALLOCATOR_STATS
+        ++m_stats.allocations;
+        if (m_allocated_count > m_stats.peak_live) {
+            m_stats.peak_live = m_allocated_count;
+        }
+        const auto* address = static_cast<const unsigned char*>(ptr);
+        if (address == m_last_allocated + m_last_allocated_count * m_slot_size) {
+            ++m_stats.adjacent;
+        }
+        m_last_allocated = address;
+        m_last_allocated_count = count;
+#endif
+    }
+
+    void recordDeallocate([[maybe_unused]] std::size_t count) noexcept {
+#ifdef ALLOCATOR_STATS
+        ++m_stats.deallocations;
+#endif
+    }
+
+    void recordFailure() noexcept {
+#ifdef ALLOCATOR_STATS
+        ++m_stats.failed;
+#endif
+    }
+
+    // Сколько слотов осталось в bump-области текущего чанка
+    std::size_t bumpSlots() const noexcept {
+        return static_cast<std::size_t>(m_bump_end - m_bump) / m_slot_size;
+    }
+
+    // First-fit поиск участка длины count; отдаётся хвост участка,
+    // чтобы его заголовок остался на месте
+    void* takeRun(std::size_t count) noexcept {
+        for (FreeRun** link = &m_free_runs; *link != nullptr;
+             link = &(*link)->next) {
+            FreeRun* run = *link;
+            if (run->length < count) {
+                continue;
+            }
+            auto* begin = reinterpret_cast<unsigned char*>(run);
+            const std::size_t rest = run->length - count;
+            if (rest >= 2) {
+                run->length = rest;
+            } else {
+                *link = run->next;
+                if (rest == 1) {
+                    m_free_head = ::new (begin) FreeSlot{m_free_head};
+                }
+            }
+            return begin + rest * m_slot_size;
+        }
+        return nullptr;
+    }
+
+    // Вернуть участок: в bump-область, если он к ней примыкает,
+    // иначе в упорядоченный список со слиянием соседей. Одиночный слот
+    // без соседей уходит в обычный free‑list.
+    void releaseRun(unsigned char* begin, std::size_t count) noexcept {
+        unsigned char* end = begin + count * m_slot_size;
+        if (end == m_bump) {
+            m_bump = begin;
+            // участок перед ним мог оказаться на границе bump-области
+            for (FreeRun** link = &m_free_runs; *link != nullptr;
+                 link = &(*link)->next) {
+                auto* run_begin = reinterpret_cast<unsigned char*>(*link);
+                if (run_begin + (*link)->length * m_slot_size == m_bump) {
+                    m_bump = run_begin;
+                    *link = (*link)->next;
+                    break;
+                }
+            }
+            return;
+        }
+
+        const auto address = reinterpret_cast<std::uintptr_t>(begin);
+        FreeRun* prev = nullptr;
+        FreeRun* next = m_free_runs;
+        while (next != nullptr &&
+               reinterpret_cast<std::uintptr_t>(next) < address) {
+            prev = next;
+            next = next->next;
+        }
+        const bool merge_next =
+            next != nullptr && reinterpret_cast<unsigned char*>(next) == end;
+        const bool merge_prev =
+            prev != nullptr && reinterpret_cast<unsigned char*>(prev) +
+                                       prev->length * m_slot_size ==
+                                   begin;
+        const std::size_t length = count + (merge_next ? next->length : 0);
+        FreeRun* after = merge_next ? next->next : next;
+        if (merge_prev) {
+            prev->length += length;  // слияние с предыдущим (и следующим)
+            prev->next = after;
+            return;
+        }
+        if (length < 2) {
+            m_free_head = ::new (begin) FreeSlot{m_free_head};
+            return;
+        }
+        auto* run = ::new (begin) FreeRun{after, length};
+        if (prev != nullptr) {
+            prev->next = run;
+        } else {
+            m_free_runs = run;
+        }
+    }
+
+    // Медленный путь: отсортировать одиночные свободные слоты по адресу
+    // и слить соседние между собой, с участками и с bump-областью
+    void absorbFreeSlots() noexcept {
+        FreeSlot* slots = sortByAddress(m_free_head);
+        m_free_head = nullptr;
+        m_unsorted_slots = 0;
+        while (slots != nullptr) {
+            auto* begin = reinterpret_cast<unsigned char*>(slots);
+            std::size_t count = 1;
+            slots = slots->next;
+            while (slots != nullptr &&
+                   reinterpret_cast<unsigned char*>(slots) ==
+                       begin + count * m_slot_size) {
+                ++count;
+                slots = slots->next;
+            }
+            releaseRun(begin, count);
+        }
+    }
+
+    // Сортировка слиянием односвязного списка по адресу, O(n log n)
+    static FreeSlot* sortByAddress(FreeSlot* list) noexcept {
+        if (list == nullptr || list->next == nullptr) {
+            return list;
+        }
+        FreeSlot* slow = list;
+        for (FreeSlot* fast = list->next; fast != nullptr &&
+                                          fast->next != nullptr;
+             fast = fast->next->next) {
+            slow = slow->next;
+        }
+        FreeSlot* right = sortByAddress(slow->next);
+        slow->next = nullptr;
+        FreeSlot* left = sortByAddress(list);
+
+        FreeSlot head{nullptr};
+        FreeSlot* tail = &head;
+        while (left != nullptr && right != nullptr) {
+            FreeSlot*& smaller = reinterpret_cast<std::uintptr_t>(left) <
+                                         reinterpret_cast<std::uintptr_t>(right)
+                                     ? left
+                                     : right;
+            tail->next = smaller;
+            tail = smaller;
+            smaller = smaller->next;
+        }
+        tail->next = left != nullptr ? left : right;
+        return head.next;
+    }
+
+    // Добавить новый чанк (не меньше min_slots слотов); его слоты выдаются
+    // bump-указателем, поэтому первое выделение — O(1), без обхода чанка
+    void grow(std::size_t min_slots) {
+        std::size_t new_slots = m_chunk_slots;
+        switch (m_growth) {
+            case GrowthPolicy::Fixed:
+                if (m_chunk_count != 0) {
+                    throw std::bad_alloc();  // свободных слотов нет
+                }
+                break;
+            case GrowthPolicy::Linear:
+                break;
+            case GrowthPolicy::Geometric:
+                if (m_chunk_count >= std::numeric_limits<std::size_t>::digits ||
+                    (new_slots << m_chunk_count) >> m_chunk_count !=
+                        new_slots) {
+                    throw std::bad_alloc();  // переполнение размера чанка
+                }
+                new_slots <<= m_chunk_count;
+                break;
+        }
+        if (new_slots < min_slots) {
+            if (m_growth == GrowthPolicy::Fixed) {
+                throw std::bad_alloc();  // участок больше всего пула
+            }
+            new_slots = min_slots;
+        }
+        if (new_slots == 0 ||
+            new_slots > (std::numeric_limits<std::size_t>::max() -
+                         headerSize()) /
+                            m_slot_size) {
+            throw std::bad_alloc();
+        }
+
+        // Выделить чанк на new_slots элементов c выравниванием памяти
+        std::size_t mapped_bytes = 0;
+        void* raw =
+            acquireChunk(headerSize() + new_slots * m_slot_size, mapped_bytes);
+        // Отображение округлено до огромной страницы: растущий пул
+        // отдаёт слотами весь хвост, а не держит его впустую
+        if (mapped_bytes != 0 && m_growth != GrowthPolicy::Fixed) {
+            new_slots = (mapped_bytes - headerSize()) / m_slot_size;
+        }
+        m_last_chunk =
+            ::new (raw) ChunkHeader{m_last_chunk, new_slots, mapped_bytes};
+        ++m_chunk_count;
+        m_capacity += new_slots;
+
+        // остаток bump-области прежнего чанка не теряется
+        const std::size_t rest = bumpSlots();
+        if (rest == 1) {
+            m_free_head = ::new (m_bump) FreeSlot{m_free_head};
+        } else if (rest > 1) {
+            unsigned char* tail = m_bump;
+            m_bump = m_bump_end = nullptr;
+            releaseRun(tail, rest);
+        }
+
+        m_bump = static_cast<unsigned char*>(raw) + headerSize();
+        m_bump_end = m_bump + new_slots * m_slot_size;
+    }
+
+    // Память под чанк: для огромных страниц — отображение, выровненное
+    // на huge_page_size; если mmap недоступен — из кучи (mapped_bytes = 0)
+    void* acquireChunk(std::size_t bytes, std::size_t& mapped_bytes) {
+#ifdef MADV_HUGEPAGE
+        if (m_backing != ChunkBacking::Heap &&
+            bytes <= std::numeric_limits<std::size_t>::max() -
+                         2 * huge_page_size) {
+            const std::size_t rounded = roundUp(bytes, huge_page_size);
+            // с запасом на выравнивание, лишнее по краям возвращается
+            const std::size_t reserved = rounded + huge_page_size;
+            void* raw = ::mmap(nullptr, reserved, PROT_READ | PROT_WRITE,
+                               MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (raw != MAP_FAILED) {
+                auto* begin = static_cast<unsigned char*>(raw);
+                auto* aligned = reinterpret_cast<unsigned char*>(
+                    roundUp(reinterpret_cast<std::uintptr_t>(begin),
+                            huge_page_size));
+                const auto head = static_cast<std::size_t>(aligned - begin);
+                if (head != 0) {
+                    ::munmap(begin, head);
+                }
+                if (reserved - head != rounded) {
+                    ::munmap(aligned + rounded, reserved - head - rounded);
+                }
+                // без поддержки THP madvise вернёт ошибку — это не страшно
+                ::madvise(aligned, rounded, MADV_HUGEPAGE);
+                if (m_backing == ChunkBacking::HugePagesPrefault) {
+                    for (std::size_t offset = 0; offset < rounded;
+                         offset += page_size) {
+                        aligned[offset] = 0;
+                    }
+                }
+                mapped_bytes = rounded;
+                return aligned;
+            }
+        }
+#endif
+        mapped_bytes = 0;
+        return ::operator new(bytes, chunkAlignment());
+    }
+
+    void releaseChunk(ChunkHeader* chunk) noexcept {
+        if (chunk->mapped_bytes != 0) {
+            ::munmap(chunk, chunk->mapped_bytes);
+        } else {
+            ::operator delete(chunk, chunkAlignment());
+        }
+    }
+
+    std::size_t m_slot_size;   // Размер слота (кратен выравниванию)
+    std::size_t m_slot_align;  // Выравнивание слота
+    std::size_t m_chunk_slots;  // Размер первого чанка в слотах
+    GrowthPolicy m_growth;
+    ChunkBacking m_backing;
+
+    FreeSlot* m_free_head{nullptr};      // Голова списка свободных слотов
+    FreeRun* m_free_runs{nullptr};       // Свободные участки по адресу
+    std::size_t m_unsorted_slots{0};  // Освобождено слотов с последней сборки
+    unsigned char* m_bump{nullptr};      // Следующий ни разу не выданный слот
+    unsigned char* m_bump_end{nullptr};  // Конец текущего чанка
+    ChunkHeader* m_last_chunk{nullptr};  // Последний выделенный чанк
+    std::size_t m_chunk_count{0};        // Сколько чанков выделено
+    std::size_t m_allocated_count{0};    // Сколько уже выделено
+    std::size_t m_capacity{0};           // Слотов во всех чанках
+#ifdef ALLOCATOR_STATS
+    SlotPoolStats m_stats{};
+    const unsigned char* m_last_allocated{nullptr};
+    std::size_t m_last_allocated_count{0};
+#endif
+};
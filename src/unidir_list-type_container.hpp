@@ -1,41 +1,121 @@
 #pragma once
 
+#include <cmath>
+#include <algorithm>
+#include <array>
+#include <cassert>
 #include <cstddef>
+#include <exception>
+#include <functional>
+#include <initializer_list>
 #include <iterator>
 #include <memory>
+#include <memory_resource>
+#include <new>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 template <typename T>
-struct MyUniDirNode {
-    MyUniDirNode() = default;
-    MyUniDirNode(T v) : m_data{v} {
+struct MyUniDirNode;
+
+// Звено без данных: из него состоит и узел, и фиктивная позиция
+// before_begin() перед первым элементом
+template <typename T>
+struct MyUniDirNodeBase {
+    MyUniDirNode<T>* m_next{nullptr};
+};
+
+template <typename T>
+struct MyUniDirNode : MyUniDirNodeBase<T> {
+    // Элемент конструируется на месте из аргументов — от T не требуется
+    // ни конструктор по умолчанию, ни копирование
+    template <typename... Args>
+    explicit MyUniDirNode(std::in_place_t, Args&&... args)
+        : m_data(std::forward<Args>(args)...) {
     }
-    MyUniDirNode* m_next{nullptr};
-    T m_data{0};
+    T m_data;
 };
 
+// Аллокатор объявляет is_run_splittable = std::true_type, если участок
+// из allocate(count) можно освобождать по одному элементу (FixedAllocator)
+template <typename Allocator, typename = void>
+struct is_run_splittable_allocator : std::false_type {};
+
+template <typename Allocator>
+struct is_run_splittable_allocator<
+    Allocator, std::void_t<typename Allocator::is_run_splittable>>
+    : Allocator::is_run_splittable {};
+
+// Аллокатор объявляет is_resettable = std::true_type и bool reset(),
+// если умеет освободить всю свою арену разом (MonotonicAllocator)
+template <typename Allocator, typename = void>
+struct is_resettable_allocator : std::false_type {};
+
+template <typename Allocator>
+struct is_resettable_allocator<Allocator,
+                               std::void_t<typename Allocator::is_resettable>>
+    : Allocator::is_resettable {};
+
 template <typename T, typename Allocator = std::allocator<T>>
 class MyUniDirListTypeContainer {
 public:
     MyUniDirListTypeContainer() = default;
+    explicit MyUniDirListTypeContainer(const Allocator& alloc);
+    template <std::input_iterator InputIt>
+    MyUniDirListTypeContainer(InputIt first, InputIt last,
+                              const Allocator& alloc = Allocator());
+    MyUniDirListTypeContainer(std::initializer_list<T> init,
+                              const Allocator& alloc = Allocator());
     MyUniDirListTypeContainer(const MyUniDirListTypeContainer& mlc);
     MyUniDirListTypeContainer(MyUniDirListTypeContainer&& mlc);
     ~MyUniDirListTypeContainer();
+    // Копирующее присваивание и assign переиспользуют имеющиеся узлы
     MyUniDirListTypeContainer& operator=(const MyUniDirListTypeContainer& mlc);
     MyUniDirListTypeContainer& operator=(MyUniDirListTypeContainer&& mlc);
-    void push_back(T value);
-    void push_front(T value);
-    int insert(T value, size_t index);
+    MyUniDirListTypeContainer& operator=(std::initializer_list<T> init);
+    template <std::input_iterator InputIt>
+    void assign(InputIt first, InputIt last);
+    void assign(std::initializer_list<T> init);
+    void push_back(const T& value);
+    void push_back(T&& value);
+    void push_front(const T& value);
+    void push_front(T&& value);
+    template <typename... Args>
+    T& emplace_back(Args&&... args);
+    template <typename... Args>
+    T& emplace_front(Args&&... args);
+    int insert(const T& value, size_t index);
+    int insert(T&& value, size_t index);
     int erase(size_t first, size_t last);
     int erase(size_t index);
     size_t size() const;
-    T operator[](size_t index) const;
+    // Доступ по индексу — O(n) обход от начала, без побочных эффектов.
+    // С enable_checkpoints() запоминается позиция последнего обращения
+    // (последовательный обход — амортизированно O(1)), произвольный
+    // доступ — O(sqrt n). Включённый индекс изменяется и в const-версии:
+    // одновременное чтение через operator[] тогда не допускается
+    const T& operator[](size_t index) const;
+    T& operator[](size_t index);
+    // Разреженный индекс: указатели на каждый stride-й узел (0 — на
+    // каждый sqrt(n)-й). При push_back/emplace_back дополняется, после
+    // остальных изменений строится заново при первом обращении. Он же
+    // задаёт точки разбиения списка для parallel_* алгоритмов.
+    // Пока индекс выключен, список хранит лишь пустой указатель на него
+    void enable_checkpoints(size_t stride = 0);
+    void disable_checkpoints() noexcept;
+    bool checkpoints_enabled() const noexcept;
     void clear();
     bool empty() const;
+    Allocator get_allocator() const;
     // Добавлено для параметризации аллокатором
     using value_type = T;
     using allocator_type = Allocator;
     using size_type = std::size_t;
 
+    using node_base_type = MyUniDirNodeBase<T>;
     using node_type = MyUniDirNode<T>;
     using node_allocator_type = typename std::allocator_traits<
         allocator_type>::template rebind_alloc<node_type>;
@@ -51,13 +131,13 @@ public:
         using pointer = T*;
         using reference = T&;
         // конструктор от указателя
-        iterator(node_type* ptr) noexcept : m_ptr(ptr) {
+        iterator(node_base_type* ptr) noexcept : m_ptr(ptr) {
         }
         reference operator*() const noexcept {  // разыменование
-            return m_ptr->m_data;
+            return static_cast<node_type*>(m_ptr)->m_data;
         }
         pointer operator->() const noexcept {  // доступ к членам
-            return &m_ptr->m_data;
+            return &static_cast<node_type*>(m_ptr)->m_data;
         }
         iterator& operator++() noexcept {  // префиксный инкремент
             m_ptr = m_ptr->m_next;
@@ -75,7 +155,9 @@ public:
             return m_ptr != other.m_ptr;
         }
     private:
-        node_type* m_ptr;  // внутренний указатель на узел
+        friend class MyUniDirListTypeContainer;
+        friend class const_iterator;
+        node_base_type* m_ptr;  // внутренний указатель на узел
     };
 
     // Константный итератор
@@ -87,15 +169,15 @@ public:
         using pointer = const T*;
         using reference = const T&;
 
-        const_iterator(const node_type* ptr) noexcept : m_ptr(ptr) {
+        const_iterator(const node_base_type* ptr) noexcept : m_ptr(ptr) {
         }
         const_iterator(const iterator& it) noexcept : m_ptr(it.m_ptr) {
         }
         reference operator*() const noexcept {
-            return m_ptr->m_data;
+            return static_cast<const node_type*>(m_ptr)->m_data;
         }
         pointer operator->() const noexcept {
-            return &m_ptr->m_data;
+            return &static_cast<const node_type*>(m_ptr)->m_data;
         }
         const_iterator& operator++() noexcept {
             m_ptr = m_ptr->m_next;
@@ -113,16 +195,27 @@ public:
             return m_ptr != other.m_ptr;
         }
     private:
-        const node_type* m_ptr;
+        friend class MyUniDirListTypeContainer;
+        const node_base_type* m_ptr;
     };
+    // Позиция перед первым элементом — для *_after операций
+    iterator before_begin() noexcept {
+        return iterator(&m_before_head);
+    }
+    const_iterator before_begin() const noexcept {
+        return const_iterator(&m_before_head);
+    }
+    const_iterator cbefore_begin() const noexcept {
+        return const_iterator(&m_before_head);
+    }
     iterator begin() noexcept {
-        return iterator(m_head);
+        return iterator(m_before_head.m_next);
     }
     iterator end() noexcept {
         return iterator(nullptr);
     }
     const_iterator begin() const noexcept {  // const begin() для const-объектов
-        return const_iterator(m_head);
+        return const_iterator(m_before_head.m_next);
     }
 
     const_iterator end() const noexcept {  // const end() для const-объектов
@@ -131,58 +224,221 @@ public:
 
     const_iterator cbegin()
         const noexcept {  // cbegin() — всегда const-итератор
-        return const_iterator(m_head);
+        return const_iterator(m_before_head.m_next);
     }
 
     const_iterator cend()
         const noexcept {  // cend() — всегда const-итератор конца
         return const_iterator(nullptr);
     }
+
+    // Операции по позиции, как у std::forward_list: O(1) на элемент.
+    // Возвращают итератор на последний вставленный / следующий за удалёнными
+    template <typename... Args>
+    iterator emplace_after(const_iterator pos, Args&&... args);
+    iterator insert_after(const_iterator pos, const T& value);
+    iterator insert_after(const_iterator pos, T&& value);
+    template <typename InputIt>
+    iterator insert_after(const_iterator pos, InputIt first, InputIt last);
+    iterator erase_after(const_iterator pos);
+    iterator erase_after(const_iterator first, const_iterator last);
+    // Перенос узлов из other без копирования; аллокаторы должны быть равны
+    void splice_after(const_iterator pos, MyUniDirListTypeContainer& other);
+    void splice_after(const_iterator pos, MyUniDirListTypeContainer&& other);
+    void splice_after(const_iterator pos, MyUniDirListTypeContainer& other,
+                      const_iterator it);
+    void splice_after(const_iterator pos, MyUniDirListTypeContainer&& other,
+                      const_iterator it);
+    void splice_after(const_iterator pos, MyUniDirListTypeContainer& other,
+                      const_iterator first, const_iterator last);
+    void splice_after(const_iterator pos, MyUniDirListTypeContainer&& other,
+                      const_iterator first, const_iterator last);
+
+    // Упорядочивание перестановкой узлов — без выделения памяти, поэтому
+    // работает и в заполненном пуле FixedAllocator.
+    // sort — восходящая сортировка слиянием, O(n log n), устойчивая
+    template <typename Compare = std::less<>>
+    void sort(Compare comp = Compare{});
+    // Слияние отсортированных списков; other остаётся пустым.
+    // Узлы переносятся, как в splice_after: аллокаторы должны быть равны
+    template <typename Compare = std::less<>>
+    void merge(MyUniDirListTypeContainer& other, Compare comp = Compare{});
+    template <typename Compare = std::less<>>
+    void merge(MyUniDirListTypeContainer&& other, Compare comp = Compare{});
+    // Удаление подряд идущих равных; возвращает число удалённых
+    template <typename BinaryPredicate = std::equal_to<>>
+    size_type unique(BinaryPredicate pred = BinaryPredicate{});
+
+    // Переупорядочить элементы по узлам так, чтобы порядок списка совпал
+    // с порядком адресов узлов: после многих insert/erase free-list пула
+    // раздаёт слоты вразнобой и каждый шаг обхода — промах кэша.
+    // Узлы не перевыделяются, элементы обмениваются между ними;
+    // итераторы и ссылки на элементы становятся недействительными.
+    // Временный массив на size() записей берётся у аллокатора контейнера;
+    // если его выделить нельзя, исключение вылетает до изменения списка
+    void compact();
+    // Доля переходов по списку к узлу с меньшим адресом:
+    // 0 — узлы идут по возрастанию адресов, ~0.5 — в случайном порядке
+    double disorder() const noexcept;
+
+    // Обход всех элементов по порядку; возвращает f, как std::for_each.
+    // prefetch_lanes > 0 при enable_checkpoints(): участки между
+    // контрольными точками берутся группами по prefetch_lanes (не более
+    // max_prefetch_lanes). Сначала все участки группы проходятся
+    // одновременно, по узлу из каждого за раунд: цепочки независимы, и их
+    // промахи кэша перекрываются. Затем f обходит уже загруженную группу.
+    // Группа (prefetch_lanes * шаг индекса узлов) должна помещаться в кэш.
+    // Без индекса или при prefetch_lanes == 0 — обычный обход
+    static constexpr size_type max_prefetch_lanes = 16;
+    template <typename Function>
+    Function for_each(Function f, size_type prefetch_lanes = 0);
+    template <typename Function>
+    Function for_each(Function f, size_type prefetch_lanes = 0) const;
+
+    // Параллельные алгоритмы: список делится по контрольным точкам на
+    // участки, каждый участок обходит свой std::thread (threads = 0 —
+    // по числу ядер). Без enable_checkpoints() начала участков ищутся
+    // последовательным проходом, и ускорения нет. Списки короче
+    // parallel_min_segment на поток обрабатываются в вызывающем потоке.
+    // Функции вызываются одновременно из нескольких потоков; исключение
+    // из любого участка передаётся вызывающему после завершения всех.
+    // Как и для operator[], построение индекса в const-версиях не
+    // допускает одновременных вызовов на одном списке
+    static constexpr size_type parallel_min_segment = 16384;
+    template <typename Function>
+    void parallel_for_each(Function f, size_type threads = 0);
+    template <typename Function>
+    void parallel_for_each(Function f, size_type threads = 0) const;
+    // reduce должна быть ассоциативной: участки сворачиваются независимо,
+    // частичные результаты объединяются с init по порядку участков
+    template <typename U, typename Reduce, typename Transform>
+    U parallel_transform_reduce(U init, Reduce reduce, Transform transform,
+                                size_type threads = 0) const;
+    template <typename Predicate>
+    size_type parallel_count_if(Predicate pred, size_type threads = 0) const;
 private:
-    node_type* m_head{nullptr};
+    node_base_type m_before_head{};  // m_before_head.m_next — первый узел
     node_type* m_tail{nullptr};
     size_type m_size{0};
     node_allocator_type
         m_node_allocator{};  // добавлено для параметризации аллокатором
+    // Освобождение всех узлов; для тривиально разрушаемых T и арены,
+    // которой список владеет единолично, — за O(1) сбросом арены
     void free_up_memory();
     // Добавлено для параметризации аллокатором
-    node_type* createNode(const T& value);
+    template <typename... Args>
+    node_type* createNode(Args&&... args);
+    // Связывание нового узла: в конец, в начало, по индексу
+    void linkBack(node_type* new_node);
+    void linkFront(node_type* new_node);
+    int linkAt(node_type* new_node, size_t index);
+    void linkAfter(node_base_type* pos, node_type* new_node);
+    // Последний узел цепочки, начинающейся с node
+    static node_type* lastOf(node_type* node) noexcept;
+    // Добавить в конец count элементов, начиная с first; если аллокатор
+    // позволяет — все узлы одним непрерывным участком
+    template <typename InputIt>
+    void appendCopies(InputIt first, size_type count);
+    // Узел по позиции; nullptr для before_begin()
+    node_type* nodeAt(node_base_type* pos) noexcept;
 
     void destroyNode(node_type* node);
+
+    // Узел с номером index с учётом курсора и разреженного индекса
+    node_type* locate(size_type index) const;
+    void rebuildCheckpoints() const;
+    // Сброс кэша позиций после изменения структуры списка
+    void invalidatePositions() const noexcept;
+
+    // Позиционный индекс, создаётся enable_checkpoints()
+    struct PositionIndex {
+        // Последнее обращение через operator[]
+        node_type* cursor_node{nullptr};
+        size_type cursor_index{0};
+        // checkpoints[k] — узел номер k * stride
+        std::vector<node_type*> checkpoints;
+        size_type stride{0};
+        bool valid{false};
+        size_type requested_stride{0};  // заданный шаг, 0 — sqrt(n)
+    };
+    std::unique_ptr<PositionIndex> m_index;
+
+    // Общая часть for_each для const и не-const узлов: обход [first, last)
+    template <typename Node, typename Function>
+    static void walk(Node* first, Node* last, Function& f);
+    // for_each с предвыборкой группами по lanes участков индекса
+    template <typename Node, typename Function>
+    void prefetchWalk(Function& f, size_type lanes) const;
+
+    // Число участков для threads потоков
+    size_type segmentCount(size_type threads) const;
+    // Первые узлы не более чем parts участков
+    std::vector<node_type*> splitPoints(size_type parts) const;
+    // segment(index, first, last) для каждого участка [first, last):
+    // нулевой — в вызывающем потоке, остальные — в новых
+    template <typename Segment>
+    void runSegments(size_type parts, Segment segment) const;
 };
 
+template <typename T, typename Allocator>
+MyUniDirListTypeContainer<T, Allocator>::MyUniDirListTypeContainer(
+    const Allocator& alloc)
+    : m_node_allocator(alloc) {
+}
+
 template <typename T, typename Allocator>
 MyUniDirListTypeContainer<T, Allocator>::MyUniDirListTypeContainer(
     const MyUniDirListTypeContainer& mlc)
-    : m_node_allocator(mlc.m_node_allocator) {
-    if (mlc.m_size != 0) {
-        node_type* prev_new_node = nullptr;
-        for (node_type* temp = mlc.m_head; temp != nullptr;
-             temp = temp->m_next) {
-            node_type* new_node = createNode(temp->m_data);
-            if (temp == mlc.m_head) {
-                m_head = new_node;
-            }
-            if (temp->m_next == nullptr) {
-                m_tail = new_node;
-            }
-            if (prev_new_node != nullptr) {
-                prev_new_node->m_next = new_node;
-            }
-            prev_new_node = new_node;
-            m_size++;
-        }
+    : m_node_allocator(
+          node_allocator_traits::select_on_container_copy_construction(
+              mlc.m_node_allocator)) {
+    if (mlc.m_index != nullptr) {
+        enable_checkpoints(mlc.m_index->requested_stride);
+    }
+    // Деструктор недостроенного объекта не вызывается: уже связанные
+    // узлы освобождаем сами
+    try {
+        appendCopies(mlc.cbegin(), mlc.m_size);
+    } catch (...) {
+        free_up_memory();
+        throw;
+    }
+}
+
+template <typename T, typename Allocator>
+template <std::input_iterator InputIt>
+MyUniDirListTypeContainer<T, Allocator>::MyUniDirListTypeContainer(
+    InputIt first, InputIt last, const Allocator& alloc)
+    : m_node_allocator(alloc) {
+    try {
+        assign(first, last);
+    } catch (...) {
+        free_up_memory();
+        throw;
+    }
+}
+
+template <typename T, typename Allocator>
+MyUniDirListTypeContainer<T, Allocator>::MyUniDirListTypeContainer(
+    std::initializer_list<T> init, const Allocator& alloc)
+    : m_node_allocator(alloc) {
+    try {
+        appendCopies(init.begin(), init.size());
+    } catch (...) {
+        free_up_memory();
+        throw;
     }
 }
 
 template <typename T, typename Allocator>
 MyUniDirListTypeContainer<T, Allocator>::MyUniDirListTypeContainer(
     MyUniDirListTypeContainer&& mlc)
-    : m_head(mlc.m_head),
+    : m_before_head(mlc.m_before_head),
       m_tail(mlc.m_tail),
       m_size(mlc.m_size),
-      m_node_allocator(std::move(mlc.m_node_allocator)) {
-    mlc.m_head = nullptr;
+      m_node_allocator(std::move(mlc.m_node_allocator)),
+      m_index(std::move(mlc.m_index)) {
+    mlc.m_before_head.m_next = nullptr;
     mlc.m_tail = nullptr;
     mlc.m_size = 0;
 }
@@ -196,29 +452,18 @@ template <typename T, typename Allocator>
 MyUniDirListTypeContainer<T, Allocator>&
 MyUniDirListTypeContainer<T, Allocator>::operator=(
     const MyUniDirListTypeContainer& mlc) {
-    free_up_memory();
-    m_size = 0;
-    if (mlc.m_size != 0) {
-        node_type* prev_new_node = nullptr;
-        for (node_type* temp = mlc.m_head; temp != nullptr;
-             temp = temp->m_next) {
-            node_type* new_node = createNode(temp->m_data);
-            if (temp == mlc.m_head) {
-                m_head = new_node;
-            }
-            if (temp->m_next == nullptr) {
-                m_tail = new_node;
-            }
-            if (prev_new_node != nullptr) {
-                prev_new_node->m_next = new_node;
-            }
-            prev_new_node = new_node;
-            m_size++;
+    if (this == &mlc) {
+        return *this;
+    }
+    if constexpr (node_allocator_traits::
+                      propagate_on_container_copy_assignment::value) {
+        // узлы, выделенные прежним аллокатором, переиспользовать нельзя
+        if (m_node_allocator != mlc.m_node_allocator) {
+            clear();
         }
-    } else {
-        m_head = nullptr;
-        m_tail = nullptr;
+        m_node_allocator = mlc.m_node_allocator;
     }
+    assign(mlc.cbegin(), mlc.cend());
     return *this;
 }
 
@@ -226,22 +471,310 @@ template <typename T, typename Allocator>
 MyUniDirListTypeContainer<T, Allocator>&
 MyUniDirListTypeContainer<T, Allocator>::operator=(
     MyUniDirListTypeContainer&& mlc) {
+    if (this == &mlc) {
+        return *this;
+    }
+    if constexpr (!node_allocator_traits::
+                      propagate_on_container_move_assignment::value) {
+        // аллокатор не переносится (например, std::pmr::polymorphic_allocator):
+        // узлы из чужого ресурса нельзя забрать — переносим поэлементно
+        if (m_node_allocator != mlc.m_node_allocator) {
+            clear();
+            for (node_type* temp = mlc.m_before_head.m_next; temp != nullptr;
+                 temp = temp->m_next) {
+                push_back(std::move(temp->m_data));
+            }
+            mlc.clear();
+            return *this;
+        }
+    }
     free_up_memory();
-    m_head = mlc.m_head;
+    invalidatePositions();
+    mlc.invalidatePositions();
+    m_before_head.m_next = mlc.m_before_head.m_next;
     m_tail = mlc.m_tail;
     m_size = mlc.m_size;
-    m_node_allocator = std::move(mlc.m_node_allocator);
-    mlc.m_head = nullptr;
+    if constexpr (node_allocator_traits::
+                      propagate_on_container_move_assignment::value) {
+        m_node_allocator = std::move(mlc.m_node_allocator);
+    }
+    mlc.m_before_head.m_next = nullptr;
     mlc.m_tail = nullptr;
     mlc.m_size = 0;
     return *this;
 }
 
 template <typename T, typename Allocator>
-void MyUniDirListTypeContainer<T, Allocator>::push_back(T value) {
-    node_type* new_node = createNode(value);
-    if (m_head == nullptr) {
-        m_head = new_node;
+MyUniDirListTypeContainer<T, Allocator>&
+MyUniDirListTypeContainer<T, Allocator>::operator=(
+    std::initializer_list<T> init) {
+    assign(init);
+    return *this;
+}
+
+template <typename T, typename Allocator>
+template <std::input_iterator InputIt>
+void MyUniDirListTypeContainer<T, Allocator>::assign(InputIt first,
+                                                     InputIt last) {
+    invalidatePositions();
+    // Сначала присваиваем значения в уже имеющиеся узлы
+    node_base_type* prev = &m_before_head;
+    for (; prev->m_next != nullptr && first != last; ++first) {
+        prev->m_next->m_data = *first;
+        prev = prev->m_next;
+    }
+    if (prev->m_next != nullptr) {
+        erase_after(const_iterator(prev), cend());
+    } else if constexpr (std::forward_iterator<InputIt>) {
+        appendCopies(first, static_cast<size_type>(std::distance(first, last)));
+    } else {
+        for (; first != last; ++first) {
+            emplace_back(*first);
+        }
+    }
+}
+
+template <typename T, typename Allocator>
+void MyUniDirListTypeContainer<T, Allocator>::assign(
+    std::initializer_list<T> init) {
+    assign(init.begin(), init.end());
+}
+
+template <typename T, typename Allocator>
+void MyUniDirListTypeContainer<T, Allocator>::push_back(const T& value) {
+    linkBack(createNode(value));
+}
+
+template <typename T, typename Allocator>
+void MyUniDirListTypeContainer<T, Allocator>::push_back(T&& value) {
+    linkBack(createNode(std::move(value)));
+}
+
+template <typename T, typename Allocator>
+void MyUniDirListTypeContainer<T, Allocator>::push_front(const T& value) {
+    linkFront(createNode(value));
+}
+
+template <typename T, typename Allocator>
+void MyUniDirListTypeContainer<T, Allocator>::push_front(T&& value) {
+    linkFront(createNode(std::move(value)));
+}
+
+template <typename T, typename Allocator>
+template <typename... Args>
+T& MyUniDirListTypeContainer<T, Allocator>::emplace_back(Args&&... args) {
+    node_type* new_node = createNode(std::forward<Args>(args)...);
+    linkBack(new_node);
+    return new_node->m_data;
+}
+
+template <typename T, typename Allocator>
+template <typename... Args>
+T& MyUniDirListTypeContainer<T, Allocator>::emplace_front(Args&&... args) {
+    node_type* new_node = createNode(std::forward<Args>(args)...);
+    linkFront(new_node);
+    return new_node->m_data;
+}
+
+template <typename T, typename Allocator>
+template <typename... Args>
+typename MyUniDirListTypeContainer<T, Allocator>::iterator
+MyUniDirListTypeContainer<T, Allocator>::emplace_after(const_iterator pos,
+                                                       Args&&... args) {
+    node_type* new_node = createNode(std::forward<Args>(args)...);
+    linkAfter(const_cast<node_base_type*>(pos.m_ptr), new_node);
+    return iterator(new_node);
+}
+
+template <typename T, typename Allocator>
+typename MyUniDirListTypeContainer<T, Allocator>::iterator
+MyUniDirListTypeContainer<T, Allocator>::insert_after(const_iterator pos,
+                                                      const T& value) {
+    return emplace_after(pos, value);
+}
+
+template <typename T, typename Allocator>
+typename MyUniDirListTypeContainer<T, Allocator>::iterator
+MyUniDirListTypeContainer<T, Allocator>::insert_after(const_iterator pos,
+                                                      T&& value) {
+    return emplace_after(pos, std::move(value));
+}
+
+template <typename T, typename Allocator>
+template <typename InputIt>
+typename MyUniDirListTypeContainer<T, Allocator>::iterator
+MyUniDirListTypeContainer<T, Allocator>::insert_after(const_iterator pos,
+                                                      InputIt first,
+                                                      InputIt last) {
+    iterator result(const_cast<node_base_type*>(pos.m_ptr));
+    for (; first != last; ++first) {
+        result = emplace_after(result, *first);
+    }
+    return result;
+}
+
+template <typename T, typename Allocator>
+typename MyUniDirListTypeContainer<T, Allocator>::iterator
+MyUniDirListTypeContainer<T, Allocator>::erase_after(const_iterator pos) {
+    auto* prev = const_cast<node_base_type*>(pos.m_ptr);
+    node_type* node = prev->m_next;
+    prev->m_next = node->m_next;
+    if (m_tail == node) {
+        m_tail = nodeAt(prev);
+    }
+    destroyNode(node);
+    --m_size;
+    return iterator(prev->m_next);
+}
+
+template <typename T, typename Allocator>
+typename MyUniDirListTypeContainer<T, Allocator>::iterator
+MyUniDirListTypeContainer<T, Allocator>::erase_after(const_iterator first,
+                                                     const_iterator last) {
+    auto* prev = const_cast<node_base_type*>(first.m_ptr);
+    auto* stop = const_cast<node_base_type*>(last.m_ptr);
+    for (node_type* node = prev->m_next; node != stop;) {
+        node_type* next = node->m_next;
+        destroyNode(node);
+        --m_size;
+        node = next;
+    }
+    prev->m_next = static_cast<node_type*>(stop);
+    if (stop == nullptr) {
+        m_tail = nodeAt(prev);
+    }
+    return iterator(stop);
+}
+
+template <typename T, typename Allocator>
+void MyUniDirListTypeContainer<T, Allocator>::splice_after(
+    const_iterator pos, MyUniDirListTypeContainer& other) {
+    if (other.m_size == 0 || this == &other) {
+        return;
+    }
+    invalidatePositions();
+    other.invalidatePositions();
+    auto* prev = const_cast<node_base_type*>(pos.m_ptr);
+    other.m_tail->m_next = prev->m_next;
+    prev->m_next = other.m_before_head.m_next;
+    if (other.m_tail->m_next == nullptr) {
+        m_tail = other.m_tail;
+    }
+    m_size += other.m_size;
+    other.m_before_head.m_next = nullptr;
+    other.m_tail = nullptr;
+    other.m_size = 0;
+}
+
+template <typename T, typename Allocator>
+void MyUniDirListTypeContainer<T, Allocator>::splice_after(
+    const_iterator pos, MyUniDirListTypeContainer&& other) {
+    splice_after(pos, other);
+}
+
+template <typename T, typename Allocator>
+void MyUniDirListTypeContainer<T, Allocator>::splice_after(
+    const_iterator pos, MyUniDirListTypeContainer& other, const_iterator it) {
+    auto* prev = const_cast<node_base_type*>(pos.m_ptr);
+    auto* other_prev = const_cast<node_base_type*>(it.m_ptr);
+    node_type* node = other_prev->m_next;
+    if (node == nullptr || prev == other_prev || prev == node) {
+        return;
+    }
+    other.invalidatePositions();
+    other_prev->m_next = node->m_next;
+    if (other.m_tail == node) {
+        other.m_tail = other.nodeAt(other_prev);
+    }
+    --other.m_size;
+    linkAfter(prev, node);
+}
+
+template <typename T, typename Allocator>
+void MyUniDirListTypeContainer<T, Allocator>::splice_after(
+    const_iterator pos, MyUniDirListTypeContainer&& other, const_iterator it) {
+    splice_after(pos, other, it);
+}
+
+template <typename T, typename Allocator>
+void MyUniDirListTypeContainer<T, Allocator>::splice_after(
+    const_iterator pos, MyUniDirListTypeContainer& other, const_iterator first,
+    const_iterator last) {
+    auto* prev = const_cast<node_base_type*>(pos.m_ptr);
+    auto* other_prev = const_cast<node_base_type*>(first.m_ptr);
+    auto* stop = const_cast<node_base_type*>(last.m_ptr);
+    if (other_prev->m_next == stop) {
+        return;
+    }
+    invalidatePositions();
+    other.invalidatePositions();
+    // Последний переносимый узел и длина диапазона (first, last)
+    node_type* range_last = other_prev->m_next;
+    size_type count = 1;
+    while (range_last->m_next != stop) {
+        range_last = range_last->m_next;
+        ++count;
+    }
+    node_type* range_first = other_prev->m_next;
+    other_prev->m_next = static_cast<node_type*>(stop);
+    if (other.m_tail == range_last) {
+        other.m_tail = other.nodeAt(other_prev);
+    }
+    other.m_size -= count;
+
+    range_last->m_next = prev->m_next;
+    prev->m_next = range_first;
+    if (range_last->m_next == nullptr) {
+        m_tail = range_last;
+    }
+    m_size += count;
+}
+
+template <typename T, typename Allocator>
+void MyUniDirListTypeContainer<T, Allocator>::splice_after(
+    const_iterator pos, MyUniDirListTypeContainer&& other, const_iterator first,
+    const_iterator last) {
+    splice_after(pos, other, first, last);
+}
+
+template <typename T, typename Allocator>
+int MyUniDirListTypeContainer<T, Allocator>::insert(const T& value,
+                                                    size_t index) {
+    if (index >= m_size && !(index == 0 && m_size == 0)) {
+        return -1;
+    }
+    return linkAt(createNode(value), index);
+}
+
+template <typename T, typename Allocator>
+int MyUniDirListTypeContainer<T, Allocator>::insert(T&& value, size_t index) {
+    if (index >= m_size && !(index == 0 && m_size == 0)) {
+        return -1;
+    }
+    return linkAt(createNode(std::move(value)), index);
+}
+
+template <typename T, typename Allocator>
+void MyUniDirListTypeContainer<T, Allocator>::linkBack(node_type* new_node) {
+    // Добавление в конец не сдвигает номера: кэш позиций остаётся верным.
+    // Шаг sqrt(n) устаревает с ростом: при (2 * stride)² элементах
+    // индекс перестраивается лениво с удвоенным шагом
+    if (m_index != nullptr && m_index->valid) {
+        PositionIndex& index = *m_index;
+        if (index.requested_stride == 0 &&
+            m_size >= 4 * index.stride * index.stride) {
+            index.valid = false;
+        } else if (m_size % index.stride == 0) {
+            try {
+                index.checkpoints.push_back(new_node);
+            } catch (...) {
+                // узел уже создан — индекс просто перестроится позже
+                index.valid = false;
+            }
+        }
+    }
+    if (m_before_head.m_next == nullptr) {
+        m_before_head.m_next = new_node;
     }
     if (m_tail != nullptr) {
         m_tail->m_next = new_node;
@@ -251,27 +784,28 @@ void MyUniDirListTypeContainer<T, Allocator>::push_back(T value) {
 }
 
 template <typename T, typename Allocator>
-void MyUniDirListTypeContainer<T, Allocator>::push_front(T value) {
-    node_type* new_node = createNode(value);
+void MyUniDirListTypeContainer<T, Allocator>::linkFront(node_type* new_node) {
+    invalidatePositions();
     if (m_tail == nullptr) {
         m_tail = new_node;
     } else {
-        new_node->m_next = m_head;
+        new_node->m_next = m_before_head.m_next;
     }
-    m_head = new_node;
+    m_before_head.m_next = new_node;
     ++m_size;
 }
 
 template <typename T, typename Allocator>
-int MyUniDirListTypeContainer<T, Allocator>::insert(T value, size_t index) {
-    if (index >= m_size && !(index == 0 && m_size == 0)) {
-        return -1;
-    }
-    node_type* new_node = createNode(value);
-    node_type* node = m_head;
+int MyUniDirListTypeContainer<T, Allocator>::linkAt(node_type* new_node,
+                                                    size_t index) {
+    invalidatePositions();
+    node_type* node = m_before_head.m_next;
     if (index == 0) {
-        m_head = new_node;
+        m_before_head.m_next = new_node;
         new_node->m_next = node;
+        if (m_tail == nullptr) {
+            m_tail = new_node;
+        }
     } else {
         for (size_t i = 0; i < index - 1; ++i) {
             node = node->m_next;
@@ -284,6 +818,24 @@ int MyUniDirListTypeContainer<T, Allocator>::insert(T value, size_t index) {
     return 0;
 }
 
+template <typename T, typename Allocator>
+void MyUniDirListTypeContainer<T, Allocator>::linkAfter(node_base_type* pos,
+                                                        node_type* new_node) {
+    invalidatePositions();
+    new_node->m_next = pos->m_next;
+    pos->m_next = new_node;
+    if (new_node->m_next == nullptr) {
+        m_tail = new_node;
+    }
+    ++m_size;
+}
+
+template <typename T, typename Allocator>
+typename MyUniDirListTypeContainer<T, Allocator>::node_type*
+MyUniDirListTypeContainer<T, Allocator>::nodeAt(node_base_type* pos) noexcept {
+    return pos == &m_before_head ? nullptr : static_cast<node_type*>(pos);
+}
+
 template <typename T, typename Allocator>
 int MyUniDirListTypeContainer<T, Allocator>::erase(size_t index) {
     if (index >= m_size) {
@@ -291,9 +843,9 @@ int MyUniDirListTypeContainer<T, Allocator>::erase(size_t index) {
     } else {
         node_type* nodeDel{nullptr};
         node_type* preNode{nullptr};
-        nodeDel = m_head;
+        nodeDel = m_before_head.m_next;
         if (index == 0) {
-            m_head = m_head->m_next;
+            m_before_head.m_next = m_before_head.m_next->m_next;
         } else {
             for (size_t i = 0; i <= index - 1; ++i) {
                 preNode = nodeDel;
@@ -301,6 +853,9 @@ int MyUniDirListTypeContainer<T, Allocator>::erase(size_t index) {
             }
             preNode->m_next = nodeDel->m_next;
         }
+        if (nodeDel == m_tail) {
+            m_tail = preNode;
+        }
         destroyNode(nodeDel);
     }
     --m_size;
@@ -313,17 +868,17 @@ int MyUniDirListTypeContainer<T, Allocator>::erase(size_t first, size_t last) {
         return -1;
     } else {
         node_type* nodeDelStart{nullptr};
-        node_type* nodeDelEnd = m_head;
-        node_type* preNode = m_head;
+        node_type* nodeDelEnd = m_before_head.m_next;
+        node_type* preNode = m_before_head.m_next;
         node_type* afterNode{nullptr};
         if (first == 0) {
-            if (m_head == m_tail) {
-                destroyNode(m_head);
-                m_head = m_tail = nullptr;
+            if (m_before_head.m_next == m_tail) {
+                destroyNode(m_before_head.m_next);
+                m_before_head.m_next = m_tail = nullptr;
                 m_size = 0;
                 return 0;
             }
-            nodeDelStart = m_head;
+            nodeDelStart = m_before_head.m_next;
         } else {
             for (size_t i = 0; i < first - 1; ++i) {
                 preNode = preNode->m_next;
@@ -334,7 +889,7 @@ int MyUniDirListTypeContainer<T, Allocator>::erase(size_t first, size_t last) {
         if (last == m_size - 1) {
             nodeDelEnd = m_tail;
             afterNode = nullptr;
-            m_tail = preNode;
+            m_tail = first == 0 ? nullptr : preNode;
         } else {
             for (size_t i = 0; i < last; ++i) {
                 nodeDelEnd = nodeDelEnd->m_next;
@@ -342,7 +897,7 @@ int MyUniDirListTypeContainer<T, Allocator>::erase(size_t first, size_t last) {
             afterNode = nodeDelEnd->m_next;
         }
         if (first == 0) {
-            m_head = afterNode;
+            m_before_head.m_next = afterNode;
         } else {
             preNode->m_next = afterNode;
         }
@@ -362,20 +917,42 @@ size_t MyUniDirListTypeContainer<T, Allocator>::size() const {
 }
 
 template <typename T, typename Allocator>
-T MyUniDirListTypeContainer<T, Allocator>::operator[](size_t index) const {
-    node_type* node = m_head;
-    if (index != 0) {
-        for (size_t i = 0; i < index; ++i) {
-            node = node->m_next;
-        }
+const T& MyUniDirListTypeContainer<T, Allocator>::operator[](
+    size_t index) const {
+    return locate(index)->m_data;
+}
+
+template <typename T, typename Allocator>
+T& MyUniDirListTypeContainer<T, Allocator>::operator[](size_t index) {
+    return const_cast<T&>(std::as_const(*this)[index]);
+}
+
+template <typename T, typename Allocator>
+void MyUniDirListTypeContainer<T, Allocator>::enable_checkpoints(
+    size_type stride) {
+    if (m_index == nullptr) {
+        m_index = std::make_unique<PositionIndex>();
+    } else if (stride != m_index->requested_stride) {
+        m_index->valid = false;
     }
-    return node->m_data;
+    m_index->requested_stride = stride;
+}
+
+template <typename T, typename Allocator>
+void MyUniDirListTypeContainer<T, Allocator>::disable_checkpoints() noexcept {
+    m_index.reset();
+}
+
+template <typename T, typename Allocator>
+bool MyUniDirListTypeContainer<T, Allocator>::checkpoints_enabled()
+    const noexcept {
+    return m_index != nullptr;
 }
 
 template <typename T, typename Allocator>
 void MyUniDirListTypeContainer<T, Allocator>::clear() {
     free_up_memory();
-    m_head = nullptr;
+    m_before_head.m_next = nullptr;
     m_tail = nullptr;
     m_size = 0;
 }
@@ -385,22 +962,39 @@ bool MyUniDirListTypeContainer<T, Allocator>::empty() const {
     return m_size == 0;
 }
 
+template <typename T, typename Allocator>
+Allocator MyUniDirListTypeContainer<T, Allocator>::get_allocator() const {
+    return Allocator(m_node_allocator);
+}
+
 template <typename T, typename Allocator>
 void MyUniDirListTypeContainer<T, Allocator>::free_up_memory() {
-    if (m_head != nullptr && m_tail != nullptr) {
-        for (node_type* temp; m_head != nullptr; m_head = temp) {
-            temp = m_head->m_next;
-            destroyNode(m_head);
+    if constexpr (std::is_trivially_destructible_v<T> &&
+                  is_resettable_allocator<node_allocator_type>::value) {
+        if (m_before_head.m_next != nullptr && m_node_allocator.reset()) {
+            invalidatePositions();
+            m_before_head.m_next = nullptr;
+            return;
+        }
+    }
+    if (m_before_head.m_next != nullptr && m_tail != nullptr) {
+        for (node_type* temp; m_before_head.m_next != nullptr;
+             m_before_head.m_next = temp) {
+            temp = m_before_head.m_next->m_next;
+            destroyNode(m_before_head.m_next);
         }
     }
 }
 
 template <typename T, typename Allocator>
+template <typename... Args>
 typename MyUniDirListTypeContainer<T, Allocator>::node_type*
-MyUniDirListTypeContainer<T, Allocator>::createNode(const T& value) {
+MyUniDirListTypeContainer<T, Allocator>::createNode(Args&&... args) {
     node_type* node = node_allocator_traits::allocate(m_node_allocator, 1U);
     try {
-        node_allocator_traits::construct(m_node_allocator, node, value);
+        node_allocator_traits::construct(m_node_allocator, node,
+                                         std::in_place,
+                                         std::forward<Args>(args)...);
     } catch (...) {
         node_allocator_traits::deallocate(m_node_allocator, node, 1U);
         throw;
@@ -411,6 +1005,560 @@ MyUniDirListTypeContainer<T, Allocator>::createNode(const T& value) {
 template <typename T, typename Allocator>
 void MyUniDirListTypeContainer<T, Allocator>::destroyNode(
     typename MyUniDirListTypeContainer<T, Allocator>::node_type* node) {
+    invalidatePositions();
     node_allocator_traits::destroy(m_node_allocator, node);
     node_allocator_traits::deallocate(m_node_allocator, node, 1U);
 }
+
+template <typename T, typename Allocator>
+typename MyUniDirListTypeContainer<T, Allocator>::node_type*
+MyUniDirListTypeContainer<T, Allocator>::locate(size_type index) const {
+    node_type* node = m_before_head.m_next;
+    size_type position = 0;
+    if (m_index == nullptr) {
+        for (; position < index; ++position) {
+            node = node->m_next;
+        }
+        return node;
+    }
+    PositionIndex& state = *m_index;
+    if (!state.valid) {
+        rebuildCheckpoints();
+    }
+    const size_type checkpoint = index / state.stride;
+    if (checkpoint < state.checkpoints.size()) {
+        node = state.checkpoints[checkpoint];
+        position = checkpoint * state.stride;
+    }
+    // Курсор выгоднее, если он ближе к цели, чем контрольная точка
+    if (state.cursor_node != nullptr && state.cursor_index <= index &&
+        state.cursor_index >= position) {
+        node = state.cursor_node;
+        position = state.cursor_index;
+    }
+    for (; position < index; ++position) {
+        node = node->m_next;
+    }
+    state.cursor_node = node;
+    state.cursor_index = index;
+    return node;
+}
+
+template <typename T, typename Allocator>
+void MyUniDirListTypeContainer<T, Allocator>::rebuildCheckpoints() const {
+    PositionIndex& state = *m_index;
+    state.stride = state.requested_stride != 0
+                       ? state.requested_stride
+                       : static_cast<size_type>(
+                             std::sqrt(static_cast<double>(m_size)));
+    if (state.stride == 0) {
+        state.stride = 1;
+    }
+    state.checkpoints.clear();
+    state.checkpoints.reserve(m_size / state.stride + 1);
+    size_type position = 0;
+    for (node_type* node = m_before_head.m_next; node != nullptr;
+         node = node->m_next, ++position) {
+        if (position % state.stride == 0) {
+            state.checkpoints.push_back(node);
+        }
+    }
+    state.valid = true;
+}
+
+template <typename T, typename Allocator>
+void MyUniDirListTypeContainer<T, Allocator>::invalidatePositions()
+    const noexcept {
+    if (m_index != nullptr) {
+        m_index->cursor_node = nullptr;
+        m_index->valid = false;
+    }
+}
+
+template <typename T, typename Allocator>
+template <typename Compare>
+void MyUniDirListTypeContainer<T, Allocator>::sort(Compare comp) {
+    if (m_size < 2) {
+        return;
+    }
+    invalidatePositions();
+    // Проходы слияния соседних серий длины width; сравнение выполняется
+    // до перестановки узла, поэтому при исключении из comp все узлы
+    // остаются в списке (порядок — частично отсортированный)
+    for (size_type width = 1;; width *= 2) {
+        node_type* left = m_before_head.m_next;
+        node_base_type* tail = &m_before_head;
+        size_type merges = 0;
+        while (left != nullptr) {
+            ++merges;
+            node_type* right = left;
+            size_type left_size = 0;
+            while (left_size < width && right != nullptr) {
+                right = right->m_next;
+                ++left_size;
+            }
+            size_type right_size = width;
+            try {
+                while (left_size > 0 || (right_size > 0 && right != nullptr)) {
+                    node_type* node;
+                    if (left_size == 0 ||
+                        (right_size > 0 && right != nullptr &&
+                         comp(right->m_data, left->m_data))) {
+                        node = right;
+                        right = right->m_next;
+                        --right_size;
+                    } else {
+                        node = left;
+                        left = left->m_next;
+                        --left_size;
+                    }
+                    tail->m_next = node;
+                    tail = node;
+                }
+            } catch (...) {
+                // Остаток левой серии, затем правая серия и хвост списка
+                for (; left_size > 0; --left_size) {
+                    tail->m_next = left;
+                    tail = left;
+                    left = left->m_next;
+                }
+                tail->m_next = right;
+                m_tail = lastOf(m_before_head.m_next);
+                throw;
+            }
+            left = right;
+        }
+        tail->m_next = nullptr;
+        m_tail = static_cast<node_type*>(tail);
+        if (merges <= 1) {
+            break;
+        }
+    }
+}
+
+template <typename T, typename Allocator>
+template <typename Compare>
+void MyUniDirListTypeContainer<T, Allocator>::merge(
+    MyUniDirListTypeContainer& other, Compare comp) {
+    if (this == &other || other.m_size == 0) {
+        return;
+    }
+    assert(m_node_allocator == other.m_node_allocator);
+    invalidatePositions();
+    other.invalidatePositions();
+    node_type* left = m_before_head.m_next;
+    node_type* right = other.m_before_head.m_next;
+    const size_type total = m_size + other.m_size;
+    node_type* other_tail = other.m_tail;
+    other.m_before_head.m_next = nullptr;
+    other.m_tail = nullptr;
+    other.m_size = 0;
+    m_size = total;
+
+    node_base_type* tail = &m_before_head;
+    try {
+        while (left != nullptr && right != nullptr) {
+            if (comp(right->m_data, left->m_data)) {
+                tail->m_next = right;
+                tail = right;
+                right = right->m_next;
+            } else {
+                tail->m_next = left;
+                tail = left;
+                left = left->m_next;
+            }
+        }
+    } catch (...) {
+        // Узлы other уже принадлежат этому списку: дописываем оба остатка
+        tail->m_next = left;
+        m_tail->m_next = right;
+        m_tail = other_tail;
+        throw;
+    }
+    if (left != nullptr) {
+        tail->m_next = left;
+    } else {
+        tail->m_next = right;
+        m_tail = other_tail;
+    }
+}
+
+template <typename T, typename Allocator>
+template <typename Compare>
+void MyUniDirListTypeContainer<T, Allocator>::merge(
+    MyUniDirListTypeContainer&& other, Compare comp) {
+    merge(other, comp);
+}
+
+template <typename T, typename Allocator>
+template <typename BinaryPredicate>
+typename MyUniDirListTypeContainer<T, Allocator>::size_type
+MyUniDirListTypeContainer<T, Allocator>::unique(BinaryPredicate pred) {
+    size_type removed = 0;
+    node_type* node = m_before_head.m_next;
+    while (node != nullptr && node->m_next != nullptr) {
+        node_type* next = node->m_next;
+        if (pred(node->m_data, next->m_data)) {
+            node->m_next = next->m_next;
+            if (next == m_tail) {
+                m_tail = node;
+            }
+            destroyNode(next);
+            --m_size;
+            ++removed;
+        } else {
+            node = next;
+        }
+    }
+    return removed;
+}
+
+template <typename T, typename Allocator>
+template <typename InputIt>
+void MyUniDirListTypeContainer<T, Allocator>::appendCopies(InputIt first,
+                                                           size_type count) {
+    if constexpr (is_run_splittable_allocator<node_allocator_type>::value) {
+        node_type* run = nullptr;
+        if (count > 1) {
+            try {
+                run = node_allocator_traits::allocate(m_node_allocator, count);
+            } catch (const std::bad_alloc&) {
+                // нет непрерывного участка — выделяем узлы по одному
+            }
+        }
+        if (run != nullptr) {
+            size_type constructed = 0;
+            try {
+                for (; constructed < count; ++constructed, ++first) {
+                    node_allocator_traits::construct(
+                        m_node_allocator, run + constructed, std::in_place,
+                        *first);
+                }
+            } catch (...) {
+                while (constructed > 0) {
+                    node_allocator_traits::destroy(m_node_allocator,
+                                                   run + --constructed);
+                }
+                node_allocator_traits::deallocate(m_node_allocator, run,
+                                                  count);
+                throw;
+            }
+            // Узлы участка связываются в один проход и далее живут
+            // как обычные: destroyNode вернёт каждый по отдельности
+            for (size_type i = 0; i + 1 < count; ++i) {
+                run[i].m_next = run + i + 1;
+            }
+            invalidatePositions();
+            if (m_tail != nullptr) {
+                m_tail->m_next = run;
+            } else {
+                m_before_head.m_next = run;
+            }
+            m_tail = run + count - 1;
+            m_size += count;
+            return;
+        }
+    }
+    for (; count > 0; --count, ++first) {
+        emplace_back(*first);
+    }
+}
+
+template <typename T, typename Allocator>
+void MyUniDirListTypeContainer<T, Allocator>::compact() {
+    if (m_size < 2) {
+        return;
+    }
+    // После выделения массива ничто не бросает: список либо
+    // переупорядочен целиком, либо не тронут
+    static_assert(std::is_nothrow_swappable_v<T>,
+                  "compact() requires a non-throwing swap of elements");
+    // Узел и номер элемента в нём по порядку списка
+    struct CompactEntry {
+        node_type* node;
+        size_type position;
+    };
+    using entry_allocator_type = typename node_allocator_traits::
+        template rebind_alloc<CompactEntry>;
+    using entry_allocator_traits = std::allocator_traits<entry_allocator_type>;
+    entry_allocator_type entry_allocator(m_node_allocator);
+    CompactEntry* const entries =
+        entry_allocator_traits::allocate(entry_allocator, m_size);
+    invalidatePositions();
+    size_type position = 0;
+    for (node_type* node = m_before_head.m_next; node != nullptr;
+         node = node->m_next, ++position) {
+        entries[position] = CompactEntry{node, position};
+    }
+    std::sort(entries, entries + m_size,
+              [](const CompactEntry& lhs, const CompactEntry& rhs) {
+                  return std::less<const node_type*>{}(lhs.node, rhs.node);
+              });
+    // entries[k].node должен получить элемент номер k: переставляем
+    // элементы обменами вдоль циклов перестановки, без буфера под T
+    for (size_type k = 0; k < m_size; ++k) {
+        while (entries[k].position != k) {
+            const size_type target = entries[k].position;
+            using std::swap;
+            swap(entries[k].node->m_data, entries[target].node->m_data);
+            std::swap(entries[k].position, entries[target].position);
+        }
+    }
+    // Связываем узлы по возрастанию адресов
+    m_before_head.m_next = entries[0].node;
+    for (size_type k = 0; k + 1 < m_size; ++k) {
+        entries[k].node->m_next = entries[k + 1].node;
+    }
+    m_tail = entries[m_size - 1].node;
+    m_tail->m_next = nullptr;
+    entry_allocator_traits::deallocate(entry_allocator, entries, m_size);
+}
+
+template <typename T, typename Allocator>
+double MyUniDirListTypeContainer<T, Allocator>::disorder() const noexcept {
+    if (m_size < 2) {
+        return 0;
+    }
+    size_type backward = 0;
+    for (const node_type* node = m_before_head.m_next; node->m_next != nullptr;
+         node = node->m_next) {
+        if (std::less<const node_type*>{}(node->m_next, node)) {
+            ++backward;
+        }
+    }
+    return static_cast<double>(backward) / static_cast<double>(m_size - 1);
+}
+
+template <typename T, typename Allocator>
+template <typename Function>
+Function MyUniDirListTypeContainer<T, Allocator>::for_each(
+    Function f, size_type prefetch_lanes) {
+    if (prefetch_lanes != 0 && m_index != nullptr) {
+        prefetchWalk<node_type>(f, prefetch_lanes);
+    } else {
+        walk(m_before_head.m_next, static_cast<node_type*>(nullptr), f);
+    }
+    return f;
+}
+
+template <typename T, typename Allocator>
+template <typename Function>
+Function MyUniDirListTypeContainer<T, Allocator>::for_each(
+    Function f, size_type prefetch_lanes) const {
+    if (prefetch_lanes != 0 && m_index != nullptr) {
+        prefetchWalk<const node_type>(f, prefetch_lanes);
+    } else {
+        walk(static_cast<const node_type*>(m_before_head.m_next),
+             static_cast<const node_type*>(nullptr), f);
+    }
+    return f;
+}
+
+template <typename T, typename Allocator>
+template <typename Function>
+void MyUniDirListTypeContainer<T, Allocator>::parallel_for_each(
+    Function f, size_type threads) {
+    runSegments(segmentCount(threads),
+                [&f](size_type, node_type* first, node_type* last) {
+                    walk(first, last, f);
+                });
+}
+
+template <typename T, typename Allocator>
+template <typename Function>
+void MyUniDirListTypeContainer<T, Allocator>::parallel_for_each(
+    Function f, size_type threads) const {
+    runSegments(segmentCount(threads),
+                [&f](size_type, const node_type* first,
+                     const node_type* last) {
+                    walk(first, last, f);
+                });
+}
+
+template <typename T, typename Allocator>
+template <typename U, typename Reduce, typename Transform>
+U MyUniDirListTypeContainer<T, Allocator>::parallel_transform_reduce(
+    U init, Reduce reduce, Transform transform, size_type threads) const {
+    const size_type parts = segmentCount(threads);
+    std::vector<std::optional<U>> partials(parts);
+    runSegments(parts, [&](size_type index, const node_type* first,
+                           const node_type* last) {
+        if (first == last) {
+            return;
+        }
+        // Накопление в локальной переменной: соседние элементы partials
+        // лежат в одной строке кэша
+        U partial = transform(first->m_data);
+        for (const node_type* node = first->m_next; node != last;
+             node = node->m_next) {
+            partial = reduce(std::move(partial), transform(node->m_data));
+        }
+        partials[index].emplace(std::move(partial));
+    });
+    for (std::optional<U>& partial : partials) {
+        if (partial) {
+            init = reduce(std::move(init), std::move(*partial));
+        }
+    }
+    return init;
+}
+
+template <typename T, typename Allocator>
+template <typename Predicate>
+typename MyUniDirListTypeContainer<T, Allocator>::size_type
+MyUniDirListTypeContainer<T, Allocator>::parallel_count_if(
+    Predicate pred, size_type threads) const {
+    return parallel_transform_reduce(
+        size_type{0}, std::plus<>{},
+        [&pred](const T& value) -> size_type { return pred(value) ? 1 : 0; },
+        threads);
+}
+
+template <typename T, typename Allocator>
+typename MyUniDirListTypeContainer<T, Allocator>::size_type
+MyUniDirListTypeContainer<T, Allocator>::segmentCount(
+    size_type threads) const {
+    if (threads == 0) {
+        threads = std::max<size_type>(1, std::thread::hardware_concurrency());
+    }
+    return std::max<size_type>(
+        1, std::min(threads, m_size / parallel_min_segment));
+}
+
+template <typename T, typename Allocator>
+std::vector<typename MyUniDirListTypeContainer<T, Allocator>::node_type*>
+MyUniDirListTypeContainer<T, Allocator>::splitPoints(size_type parts) const {
+    std::vector<node_type*> starts;
+    if (m_index != nullptr) {
+        if (!m_index->valid) {
+            rebuildCheckpoints();
+        }
+        // Участки — равные по числу контрольных точек группы
+        const std::vector<node_type*>& checkpoints = m_index->checkpoints;
+        const size_type count = checkpoints.size();
+        parts = std::min(parts, count);
+        starts.reserve(parts);
+        for (size_type part = 0; part < parts; ++part) {
+            starts.push_back(checkpoints[part * count / parts]);
+        }
+        return starts;
+    }
+    const size_type step = (m_size + parts - 1) / parts;
+    starts.reserve(parts);
+    size_type position = 0;
+    for (node_type* node = m_before_head.m_next; node != nullptr;
+         node = node->m_next, ++position) {
+        if (position % step == 0) {
+            starts.push_back(node);
+        }
+    }
+    return starts;
+}
+
+template <typename T, typename Allocator>
+template <typename Segment>
+void MyUniDirListTypeContainer<T, Allocator>::runSegments(
+    size_type parts, Segment segment) const {
+    if (parts <= 1) {
+        segment(size_type{0}, m_before_head.m_next,
+                static_cast<node_type*>(nullptr));
+        return;
+    }
+    const std::vector<node_type*> starts = splitPoints(parts);
+    std::vector<std::exception_ptr> errors(starts.size());
+    auto run = [&](size_type index) {
+        try {
+            segment(index, starts[index],
+                    index + 1 < starts.size() ? starts[index + 1] : nullptr);
+        } catch (...) {
+            errors[index] = std::current_exception();
+        }
+    };
+    std::vector<std::thread> workers;
+    workers.reserve(starts.size() - 1);
+    try {
+        for (size_type index = 1; index < starts.size(); ++index) {
+            workers.emplace_back(run, index);
+        }
+    } catch (...) {
+        // поток не создан — дожидаемся уже запущенных
+        for (std::thread& worker : workers) {
+            worker.join();
+        }
+        throw;
+    }
+    run(0);
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    for (const std::exception_ptr& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+template <typename T, typename Allocator>
+template <typename Node, typename Function>
+void MyUniDirListTypeContainer<T, Allocator>::walk(Node* first, Node* last,
+                                                   Function& f) {
+    for (Node* node = first; node != last; node = node->m_next) {
+        f(node->m_data);
+    }
+}
+
+template <typename T, typename Allocator>
+template <typename Node, typename Function>
+void MyUniDirListTypeContainer<T, Allocator>::prefetchWalk(
+    Function& f, size_type lanes) const {
+    if (!m_index->valid) {
+        rebuildCheckpoints();
+    }
+    // Между соседними контрольными точками ровно stride узлов
+    const std::vector<node_type*>& checkpoints = m_index->checkpoints;
+    const size_type stride = m_index->stride;
+    const size_type count = checkpoints.size();
+    lanes = std::min(lanes, max_prefetch_lanes);
+    std::array<Node*, max_prefetch_lanes> runners{};
+    for (size_type group = 0; group < count; group += lanes) {
+        const size_type group_end = std::min(group + lanes, count);
+        const size_type active = group_end - group;
+        for (size_type lane = 0; lane < active; ++lane) {
+            runners[lane] = checkpoints[group + lane];
+        }
+        // Загрузки разных участков в одном раунде не зависят друг от
+        // друга и идут параллельно; последний участок может быть короче.
+        // Результат проходов нужен только кэшу: __builtin_prefetch не
+        // даёт компилятору выбросить их как мёртвый код
+        for (size_type step = 0; step < stride; ++step) {
+            for (size_type lane = 0; lane < active; ++lane) {
+                if (runners[lane] != nullptr) {
+                    runners[lane] = runners[lane]->m_next;
+                    __builtin_prefetch(runners[lane]);
+                }
+            }
+        }
+        walk(static_cast<Node*>(checkpoints[group]),
+             group_end < count ? static_cast<Node*>(checkpoints[group_end])
+                               : static_cast<Node*>(nullptr),
+             f);
+    }
+}
+
+template <typename T, typename Allocator>
+typename MyUniDirListTypeContainer<T, Allocator>::node_type*
+MyUniDirListTypeContainer<T, Allocator>::lastOf(node_type* node) noexcept {
+    if (node == nullptr) {
+        return nullptr;
+    }
+    while (node->m_next != nullptr) {
+        node = node->m_next;
+    }
+    return node;
+}
+
+// Контейнер с std::pmr::polymorphic_allocator: ресурс памяти (например,
+// PoolMemoryResource) выбирается во время выполнения
+template <typename T>
+using MyPmrUniDirListTypeContainer =
+    MyUniDirListTypeContainer<T, std::pmr::polymorphic_allocator<T>>;
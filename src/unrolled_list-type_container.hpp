@@ -0,0 +1,541 @@
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <utility>
+
+// Число элементов в узле развёрнутого списка по умолчанию:
+// узел (ссылка + счётчик + элементы) занимает одну кэш-линию
+template <typename T>
+constexpr std::size_t unrolledNodeCapacity() {
+    constexpr std::size_t cache_line = 64;
+    constexpr std::size_t header = sizeof(void*) + sizeof(std::size_t);
+    return sizeof(T) + header <= cache_line ? (cache_line - header) / sizeof(T)
+                                            : 1;
+}
+
+template <typename T, std::size_t Capacity>
+struct MyUnrolledNode {
+    static_assert(Capacity > 0, "MyUnrolledNode: Capacity must be positive");
+
+    MyUnrolledNode() = default;
+    MyUnrolledNode(const MyUnrolledNode&) = delete;
+    MyUnrolledNode& operator=(const MyUnrolledNode&) = delete;
+    ~MyUnrolledNode() = default;  // элементы разрушает контейнер
+
+    T* data() noexcept {
+        return std::launder(reinterpret_cast<T*>(m_storage));
+    }
+    const T* data() const noexcept {
+        return std::launder(reinterpret_cast<const T*>(m_storage));
+    }
+
+    MyUnrolledNode* m_next{nullptr};
+    std::size_t m_count{0};  // занятые элементы — [0, m_count)
+    alignas(T) unsigned char m_storage[Capacity * sizeof(T)];
+};
+
+// Развёрнутый (unrolled) однонаправленный список: в каждом узле до
+// Capacity элементов. API совпадает с MyUniDirListTypeContainer, но
+// обход и operator[] касаются в Capacity раз меньшего числа узлов,
+// и во столько же раз меньше обращений к аллокатору.
+template <typename T, typename Allocator = std::allocator<T>,
+          std::size_t Capacity = unrolledNodeCapacity<T>()>
+class MyUnrolledListTypeContainer {
+public:
+    MyUnrolledListTypeContainer() = default;
+    explicit MyUnrolledListTypeContainer(const Allocator& alloc);
+    MyUnrolledListTypeContainer(const MyUnrolledListTypeContainer& mlc);
+    MyUnrolledListTypeContainer(MyUnrolledListTypeContainer&& mlc) noexcept;
+    ~MyUnrolledListTypeContainer();
+    MyUnrolledListTypeContainer& operator=(
+        const MyUnrolledListTypeContainer& mlc);
+    MyUnrolledListTypeContainer& operator=(MyUnrolledListTypeContainer&& mlc);
+    void push_back(T value);
+    void push_front(T value);
+    int insert(T value, size_t index);
+    int erase(size_t first, size_t last);
+    int erase(size_t index);
+    size_t size() const;
+    T operator[](size_t index) const;
+    void clear();
+    bool empty() const;
+    Allocator get_allocator() const;
+
+    using value_type = T;
+    using allocator_type = Allocator;
+    using size_type = std::size_t;
+
+    using node_type = MyUnrolledNode<T, Capacity>;
+    using node_allocator_type = typename std::allocator_traits<
+        allocator_type>::template rebind_alloc<node_type>;
+    using node_allocator_traits = std::allocator_traits<node_allocator_type>;
+
+    static constexpr std::size_t node_capacity = Capacity;
+
+    // Итератор: узел + позиция элемента в нём (ForwardIterator)
+    template <bool IsConst>
+    class basic_iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<IsConst, const T*, T*>;
+        using reference = std::conditional_t<IsConst, const T&, T&>;
+        using node_pointer =
+            std::conditional_t<IsConst, const node_type*, node_type*>;
+
+        basic_iterator(node_pointer node = nullptr,
+                       std::size_t pos = 0) noexcept
+            : m_node(node), m_pos(pos) {
+        }
+        // iterator -> const_iterator
+        template <bool OtherConst,
+                  typename = std::enable_if_t<IsConst && !OtherConst>>
+        basic_iterator(const basic_iterator<OtherConst>& it) noexcept
+            : m_node(it.m_node), m_pos(it.m_pos) {
+        }
+        reference operator*() const noexcept {
+            return m_node->data()[m_pos];
+        }
+        pointer operator->() const noexcept {
+            return m_node->data() + m_pos;
+        }
+        basic_iterator& operator++() noexcept {
+            if (++m_pos == m_node->m_count) {
+                m_node = m_node->m_next;
+                m_pos = 0;
+            }
+            return *this;
+        }
+        basic_iterator operator++(int) noexcept {
+            basic_iterator temp = *this;
+            ++*this;
+            return temp;
+        }
+        bool operator==(const basic_iterator& other) const noexcept {
+            return m_node == other.m_node && m_pos == other.m_pos;
+        }
+        bool operator!=(const basic_iterator& other) const noexcept {
+            return !(*this == other);
+        }
+    private:
+        template <bool>
+        friend class basic_iterator;
+
+        node_pointer m_node;
+        std::size_t m_pos;
+    };
+
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    iterator begin() noexcept {
+        return iterator(m_head);
+    }
+    iterator end() noexcept {
+        return iterator(nullptr);
+    }
+    const_iterator begin() const noexcept {
+        return const_iterator(m_head);
+    }
+    const_iterator end() const noexcept {
+        return const_iterator(nullptr);
+    }
+    const_iterator cbegin() const noexcept {
+        return const_iterator(m_head);
+    }
+    const_iterator cend() const noexcept {
+        return const_iterator(nullptr);
+    }
+private:
+    node_type* m_head{nullptr};
+    node_type* m_tail{nullptr};
+    size_type m_size{0};
+    node_allocator_type m_node_allocator{};
+
+    void free_up_memory();
+    void copy_from(const MyUnrolledListTypeContainer& mlc);
+    node_type* createNode();
+    void destroyNode(node_type* node);
+    // Узел с элементом index и позиция в нём; prev — предыдущий узел
+    node_type* locate(size_t& index, node_type** prev = nullptr) const;
+    // Вставка в узел со свободным местом, позиция pos <= m_count
+    void insertIntoNode(node_type* node, std::size_t pos, T&& value);
+    // Удаление элемента pos из узла, слияние недозаполненных соседей
+    void eraseFromNode(node_type* node, node_type* prev, std::size_t pos);
+    void mergeWithNext(node_type* node);
+};
+
+template <typename T, typename Allocator, std::size_t Capacity>
+MyUnrolledListTypeContainer<T, Allocator, Capacity>::
+    MyUnrolledListTypeContainer(const Allocator& alloc)
+    : m_node_allocator(alloc) {
+}
+
+template <typename T, typename Allocator, std::size_t Capacity>
+MyUnrolledListTypeContainer<T, Allocator, Capacity>::
+    MyUnrolledListTypeContainer(const MyUnrolledListTypeContainer& mlc)
+    : m_node_allocator(
+          node_allocator_traits::select_on_container_copy_construction(
+              mlc.m_node_allocator)) {
+    copy_from(mlc);
+}
+
+template <typename T, typename Allocator, std::size_t Capacity>
+MyUnrolledListTypeContainer<T, Allocator, Capacity>::
+    MyUnrolledListTypeContainer(MyUnrolledListTypeContainer&& mlc) noexcept
+    : m_head(mlc.m_head),
+      m_tail(mlc.m_tail),
+      m_size(mlc.m_size),
+      m_node_allocator(std::move(mlc.m_node_allocator)) {
+    mlc.m_head = nullptr;
+    mlc.m_tail = nullptr;
+    mlc.m_size = 0;
+}
+
+template <typename T, typename Allocator, std::size_t Capacity>
+MyUnrolledListTypeContainer<T, Allocator,
+                            Capacity>::~MyUnrolledListTypeContainer() {
+    free_up_memory();
+}
+
+template <typename T, typename Allocator, std::size_t Capacity>
+MyUnrolledListTypeContainer<T, Allocator, Capacity>&
+MyUnrolledListTypeContainer<T, Allocator, Capacity>::operator=(
+    const MyUnrolledListTypeContainer& mlc) {
+    if (this != &mlc) {
+        clear();
+        copy_from(mlc);
+    }
+    return *this;
+}
+
+template <typename T, typename Allocator, std::size_t Capacity>
+MyUnrolledListTypeContainer<T, Allocator, Capacity>&
+MyUnrolledListTypeContainer<T, Allocator, Capacity>::operator=(
+    MyUnrolledListTypeContainer&& mlc) {
+    if (this == &mlc) {
+        return *this;
+    }
+    if constexpr (!node_allocator_traits::
+                      propagate_on_container_move_assignment::value) {
+        // узлы из чужого ресурса нельзя забрать — переносим поэлементно
+        if (m_node_allocator != mlc.m_node_allocator) {
+            clear();
+            for (T& value : mlc) {
+                push_back(std::move(value));
+            }
+            mlc.clear();
+            return *this;
+        }
+    }
+    clear();
+    m_head = mlc.m_head;
+    m_tail = mlc.m_tail;
+    m_size = mlc.m_size;
+    if constexpr (node_allocator_traits::
+                      propagate_on_container_move_assignment::value) {
+        m_node_allocator = std::move(mlc.m_node_allocator);
+    }
+    mlc.m_head = nullptr;
+    mlc.m_tail = nullptr;
+    mlc.m_size = 0;
+    return *this;
+}
+
+template <typename T, typename Allocator, std::size_t Capacity>
+void MyUnrolledListTypeContainer<T, Allocator, Capacity>::push_back(T value) {
+    if (m_tail == nullptr || m_tail->m_count == Capacity) {
+        node_type* new_node = createNode();
+        if (m_tail == nullptr) {
+            m_head = new_node;
+        } else {
+            m_tail->m_next = new_node;
+        }
+        m_tail = new_node;
+    }
+    insertIntoNode(m_tail, m_tail->m_count, std::move(value));
+}
+
+template <typename T, typename Allocator, std::size_t Capacity>
+void MyUnrolledListTypeContainer<T, Allocator, Capacity>::push_front(T value) {
+    if (m_head == nullptr || m_head->m_count == Capacity) {
+        node_type* new_node = createNode();
+        new_node->m_next = m_head;
+        if (m_head == nullptr) {
+            m_tail = new_node;
+        }
+        m_head = new_node;
+    }
+    insertIntoNode(m_head, 0, std::move(value));
+}
+
+template <typename T, typename Allocator, std::size_t Capacity>
+int MyUnrolledListTypeContainer<T, Allocator, Capacity>::insert(T value,
+                                                               size_t index) {
+    if (index >= m_size && !(index == 0 && m_size == 0)) {
+        return -1;
+    }
+    if (index == 0) {
+        push_front(std::move(value));
+        return 0;
+    }
+    node_type* node = locate(index);
+    if (node->m_count == Capacity) {
+        // узел полон — вторая половина уходит в новый узел
+        node_type* new_node = createNode();
+        const std::size_t half = Capacity / 2;
+        T* from = node->data();
+        T* to = new_node->data();
+        for (std::size_t i = half; i < Capacity; ++i) {
+            node_allocator_traits::construct(m_node_allocator, to + (i - half),
+                                             std::move(from[i]));
+            node_allocator_traits::destroy(m_node_allocator, from + i);
+        }
+        new_node->m_count = Capacity - half;
+        node->m_count = half;
+        new_node->m_next = node->m_next;
+        node->m_next = new_node;
+        if (m_tail == node) {
+            m_tail = new_node;
+        }
+        if (index > half) {
+            node = new_node;
+            index -= half;
+        }
+    }
+    insertIntoNode(node, index, std::move(value));
+    return 0;
+}
+
+template <typename T, typename Allocator, std::size_t Capacity>
+int MyUnrolledListTypeContainer<T, Allocator, Capacity>::erase(size_t index) {
+    if (index >= m_size) {
+        return -1;
+    }
+    node_type* prev = nullptr;
+    node_type* node = locate(index, &prev);
+    eraseFromNode(node, prev, index);
+    return 0;
+}
+
+template <typename T, typename Allocator, std::size_t Capacity>
+int MyUnrolledListTypeContainer<T, Allocator, Capacity>::erase(size_t first,
+                                                              size_t last) {
+    if (first >= m_size || last >= m_size || first > last) {
+        return -1;
+    }
+    size_t left = last - first + 1;
+    m_size -= left;
+    node_type* prev = nullptr;
+    node_type* node = locate(first, &prev);  // first — позиция в узле
+    node_type* const before = prev;
+    node_type* first_node = nullptr;  // уцелевший узел с позицией first
+    // один проход по узлам диапазона: сдвиг хвостов, пустые узлы — вон
+    for (std::size_t pos = first; left != 0; pos = 0) {
+        const std::size_t count = node->m_count;
+        const std::size_t take = left < count - pos ? left : count - pos;
+        T* data = node->data();
+        for (std::size_t i = pos; i + take < count; ++i) {
+            data[i] = std::move(data[i + take]);
+        }
+        for (std::size_t i = count - take; i < count; ++i) {
+            node_allocator_traits::destroy(m_node_allocator, data + i);
+        }
+        node->m_count -= take;
+        left -= take;
+
+        node_type* next = node->m_next;
+        if (node->m_count == 0) {
+            if (prev == nullptr) {
+                m_head = next;
+            } else {
+                prev->m_next = next;
+            }
+            if (m_tail == node) {
+                m_tail = prev;
+            }
+            destroyNode(node);
+        } else {
+            if (prev == before) {
+                first_node = node;
+            }
+            prev = node;
+        }
+        node = next;
+    }
+    // На стыках диапазона могли остаться недозаполненные узлы: последний
+    // уцелевший с идущим за ним, первый с последним, предшествующий
+    // диапазону с первым. Справа налево — слияние не трогает левых
+    if (prev != nullptr) {
+        mergeWithNext(prev);
+    }
+    if (first_node != nullptr && first_node != prev) {
+        mergeWithNext(first_node);
+    }
+    if (before != nullptr) {
+        mergeWithNext(before);
+    }
+    return 0;
+}
+
+template <typename T, typename Allocator, std::size_t Capacity>
+size_t MyUnrolledListTypeContainer<T, Allocator, Capacity>::size() const {
+    return m_size;
+}
+
+template <typename T, typename Allocator, std::size_t Capacity>
+T MyUnrolledListTypeContainer<T, Allocator, Capacity>::operator[](
+    size_t index) const {
+    const node_type* node = locate(index);
+    return node->data()[index];
+}
+
+template <typename T, typename Allocator, std::size_t Capacity>
+void MyUnrolledListTypeContainer<T, Allocator, Capacity>::clear() {
+    free_up_memory();
+    m_head = nullptr;
+    m_tail = nullptr;
+    m_size = 0;
+}
+
+template <typename T, typename Allocator, std::size_t Capacity>
+bool MyUnrolledListTypeContainer<T, Allocator, Capacity>::empty() const {
+    return m_size == 0;
+}
+
+template <typename T, typename Allocator, std::size_t Capacity>
+Allocator MyUnrolledListTypeContainer<T, Allocator, Capacity>::get_allocator()
+    const {
+    return Allocator(m_node_allocator);
+}
+
+template <typename T, typename Allocator, std::size_t Capacity>
+void MyUnrolledListTypeContainer<T, Allocator, Capacity>::free_up_memory() {
+    for (node_type* temp; m_head != nullptr; m_head = temp) {
+        temp = m_head->m_next;
+        destroyNode(m_head);
+    }
+}
+
+template <typename T, typename Allocator, std::size_t Capacity>
+void MyUnrolledListTypeContainer<T, Allocator, Capacity>::copy_from(
+    const MyUnrolledListTypeContainer& mlc) {
+    // копия упаковывает элементы плотно, по Capacity в узел
+    for (const T& value : mlc) {
+        push_back(value);
+    }
+}
+
+template <typename T, typename Allocator, std::size_t Capacity>
+typename MyUnrolledListTypeContainer<T, Allocator, Capacity>::node_type*
+MyUnrolledListTypeContainer<T, Allocator, Capacity>::createNode() {
+    node_type* node = node_allocator_traits::allocate(m_node_allocator, 1U);
+    ::new (static_cast<void*>(node)) node_type();
+    return node;
+}
+
+template <typename T, typename Allocator, std::size_t Capacity>
+void MyUnrolledListTypeContainer<T, Allocator, Capacity>::destroyNode(
+    node_type* node) {
+    T* data = node->data();
+    for (std::size_t i = 0; i < node->m_count; ++i) {
+        node_allocator_traits::destroy(m_node_allocator, data + i);
+    }
+    node->~node_type();
+    node_allocator_traits::deallocate(m_node_allocator, node, 1U);
+}
+
+template <typename T, typename Allocator, std::size_t Capacity>
+typename MyUnrolledListTypeContainer<T, Allocator, Capacity>::node_type*
+MyUnrolledListTypeContainer<T, Allocator, Capacity>::locate(
+    size_t& index, node_type** prev) const {
+    node_type* node = m_head;
+    while (index >= node->m_count) {
+        index -= node->m_count;
+        if (prev != nullptr) {
+            *prev = node;
+        }
+        node = node->m_next;
+    }
+    return node;
+}
+
+template <typename T, typename Allocator, std::size_t Capacity>
+void MyUnrolledListTypeContainer<T, Allocator, Capacity>::insertIntoNode(
+    node_type* node, std::size_t pos, T&& value) {
+    T* data = node->data();
+    const std::size_t count = node->m_count;
+    if (pos == count) {
+        node_allocator_traits::construct(m_node_allocator, data + count,
+                                         std::move(value));
+    } else {
+        // сдвиг хвоста узла вправо на один элемент
+        node_allocator_traits::construct(m_node_allocator, data + count,
+                                         std::move(data[count - 1]));
+        for (std::size_t i = count - 1; i > pos; --i) {
+            data[i] = std::move(data[i - 1]);
+        }
+        data[pos] = std::move(value);
+    }
+    ++node->m_count;
+    ++m_size;
+}
+
+template <typename T, typename Allocator, std::size_t Capacity>
+void MyUnrolledListTypeContainer<T, Allocator, Capacity>::eraseFromNode(
+    node_type* node, node_type* prev, std::size_t pos) {
+    T* data = node->data();
+    for (std::size_t i = pos; i + 1 < node->m_count; ++i) {
+        data[i] = std::move(data[i + 1]);
+    }
+    node_allocator_traits::destroy(m_node_allocator,
+                                   data + node->m_count - 1);
+    --node->m_count;
+    --m_size;
+
+    if (node->m_count == 0) {
+        // пустой узел выкидывается из списка
+        if (prev == nullptr) {
+            m_head = node->m_next;
+        } else {
+            prev->m_next = node->m_next;
+        }
+        if (m_tail == node) {
+            m_tail = prev;
+        }
+        destroyNode(node);
+    } else {
+        mergeWithNext(node);
+    }
+    // предыдущий узел может поглотить уменьшившийся (или следующий)
+    if (prev != nullptr) {
+        mergeWithNext(prev);
+    }
+}
+
+template <typename T, typename Allocator, std::size_t Capacity>
+void MyUnrolledListTypeContainer<T, Allocator, Capacity>::mergeWithNext(
+    node_type* node) {
+    // узел поглощает следующий, если оба помещаются в один: тогда хотя бы
+    // один из них недозаполнен (заполнен не больше чем наполовину)
+    T* data = node->data();
+    node_type* next = node->m_next;
+    if (next != nullptr && node->m_count + next->m_count <= Capacity) {
+        T* next_data = next->data();
+        for (std::size_t i = 0; i < next->m_count; ++i) {
+            node_allocator_traits::construct(m_node_allocator,
+                                             data + node->m_count + i,
+                                             std::move(next_data[i]));
+        }
+        node->m_count += next->m_count;
+        node->m_next = next->m_next;
+        if (m_tail == next) {
+            m_tail = node;
+        }
+        destroyNode(next);  // разрушит перенесённые (moved-from) элементы
+    }
+}
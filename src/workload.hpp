@@ -0,0 +1,550 @@
+#pragma once
+
+#include <sys/resource.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cerrno>
+#endif
+
+#include "allocator.hpp"
+#include "unidir_list-type_container.hpp"
+
+// Нагрузочный драйвер: контейнер (std::map или MyUniDirListTypeContainer)
+// с выбранным аллокатором заполняется count элементами, затем выполняет
+// operations операций в заданной пропорции insert/erase/lookup/iterate.
+// Последовательность операций и ключей генерируется заранее из seed, так
+// что прогоны воспроизводимы и сравнимы между версиями аллокаторов.
+// Каждая операция замеряется отдельно (steady_clock, ~20 нс накладных
+// расходов), результат — JSON: пропускная способность, перцентили
+// задержки, пиковый RSS и, по --perf, аппаратные счётчики Linux.
+
+// Виды операций; порядок совпадает с порядком долей в --mix
+enum class WorkloadOperation : unsigned char {
+    Insert,
+    Erase,
+    Lookup,
+    Iterate,
+};
+
+constexpr std::size_t WORKLOAD_OPERATION_KINDS = 4;
+constexpr std::array<const char*, WORKLOAD_OPERATION_KINDS>
+    WORKLOAD_OPERATION_NAMES{"insert", "erase", "lookup", "iterate"};
+
+struct WorkloadOptions {
+    std::string container{"map"};
+    std::string allocator{"std"};
+    std::size_t count{100'000};        // элементов до начала замера
+    std::size_t operations{1'000'000};  // замеряемых операций
+    // Доли insert:erase:lookup:iterate
+    std::array<unsigned, WORKLOAD_OPERATION_KINDS> mix{40, 10, 49, 1};
+    std::uint64_t seed{1};
+    bool perf{false};  // аппаратные счётчики через perf_event_open
+};
+
+inline void printWorkloadUsage(std::ostream& os) {
+    os << "Использование: allocator [опции]\n"
+          "Без опций — демонстрация из задания.\n"
+          "  --container=map|list        std::map или "
+          "MyUniDirListTypeContainer\n"
+          "  --allocator=std|pool-linear|pool-geometric|pool-huge\n"
+          "  --count=N                   элементов до замера (100000)\n"
+          "  --operations=N              операций в замере (1000000)\n"
+          "  --mix=I:E:L:T               доли insert:erase:lookup:iterate "
+          "(40:10:49:1)\n"
+          "  --seed=N                    зерно генератора (1)\n"
+          "  --perf                      аппаратные счётчики "
+          "(perf_event_open)\n"
+          "  --help                      эта справка\n";
+}
+
+namespace workload_detail {
+
+inline std::uint64_t parseNumber(std::string_view name,
+                                 std::string_view value) {
+    const std::string text{value};
+    std::size_t parsed = 0;
+    std::uint64_t result = 0;
+    try {
+        result = std::stoull(text, &parsed);
+    } catch (const std::exception&) {
+        parsed = 0;
+    }
+    if (text.empty() || parsed != text.size() || text.front() == '-') {
+        throw std::invalid_argument("некорректное значение " +
+                                    std::string{name} + ": " + text);
+    }
+    return result;
+}
+
+inline std::array<unsigned, WORKLOAD_OPERATION_KINDS> parseMix(
+    std::string_view value) {
+    std::array<unsigned, WORKLOAD_OPERATION_KINDS> mix{};
+    std::size_t kind = 0;
+    while (true) {
+        const auto colon = value.find(':');
+        if (kind == WORKLOAD_OPERATION_KINDS) {
+            throw std::invalid_argument("--mix: ожидается I:E:L:T");
+        }
+        const auto share = parseNumber("--mix", value.substr(0, colon));
+        if (share > std::numeric_limits<unsigned>::max()) {
+            throw std::invalid_argument("--mix: слишком большая доля");
+        }
+        mix[kind++] = static_cast<unsigned>(share);
+        if (colon == std::string_view::npos) {
+            break;
+        }
+        value.remove_prefix(colon + 1);
+    }
+    if (kind != WORKLOAD_OPERATION_KINDS ||
+        std::all_of(mix.begin(), mix.end(),
+                    [](unsigned share) { return share == 0; })) {
+        throw std::invalid_argument("--mix: ожидается I:E:L:T, не все нули");
+    }
+    return mix;
+}
+
+}  // namespace workload_detail
+
+// Разбор аргументов командной строки; при ошибке std::invalid_argument
+inline WorkloadOptions parseWorkloadOptions(int argc, char* argv[]) {
+    WorkloadOptions options;
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg{argv[i]};
+        const auto equals = arg.find('=');
+        const auto name = arg.substr(0, equals);
+        const auto value = equals == std::string_view::npos
+                               ? std::string_view{}
+                               : arg.substr(equals + 1);
+        if (name == "--perf" && equals == std::string_view::npos) {
+            options.perf = true;
+        } else if (name == "--container" &&
+                   (value == "map" || value == "list")) {
+            options.container = value;
+        } else if (name == "--allocator" &&
+                   (value == "std" || value == "pool-linear" ||
+                    value == "pool-geometric" || value == "pool-huge")) {
+            options.allocator = value;
+        } else if (name == "--count") {
+            options.count = workload_detail::parseNumber(name, value);
+        } else if (name == "--operations") {
+            options.operations = workload_detail::parseNumber(name, value);
+        } else if (name == "--mix") {
+            options.mix = workload_detail::parseMix(value);
+        } else if (name == "--seed") {
+            options.seed = workload_detail::parseNumber(name, value);
+        } else {
+            throw std::invalid_argument("неизвестная опция: " +
+                                        std::string{arg});
+        }
+    }
+    // Ключи — int из [0, 2 * count)
+    if (options.count > static_cast<std::size_t>(
+                            std::numeric_limits<int>::max() / 2)) {
+        throw std::invalid_argument("--count: слишком много элементов");
+    }
+    return options;
+}
+
+// Аппаратные счётчики процесса (только user space): такты, инструкции,
+// промахи кэша последнего уровня и промахи dTLB на чтение. Недоступные
+// счётчики (нет прав, виртуальная машина) пропускаются, причина
+// сохраняется в error()
+class PerfCounters {
+public:
+    static constexpr std::size_t kinds = 4;
+    static constexpr std::array<const char*, kinds> names{
+        "cycles", "instructions", "cache_misses", "dtlb_load_misses"};
+
+    PerfCounters() {
+        m_fds.fill(-1);
+#ifdef __linux__
+        constexpr std::array<std::pair<std::uint32_t, std::uint64_t>, kinds>
+            events{{
+                {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+                {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+                {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+                {PERF_TYPE_HW_CACHE,
+                 PERF_COUNT_HW_CACHE_DTLB |
+                     (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                     (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)},
+            }};
+        for (std::size_t i = 0; i < kinds; ++i) {
+            perf_event_attr attr{};
+            attr.size = sizeof(attr);
+            attr.type = events[i].first;
+            attr.config = events[i].second;
+            attr.disabled = 1;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            m_fds[i] = static_cast<int>(
+                ::syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+            if (m_fds[i] < 0 && m_error.empty()) {
+                m_error = std::string{names[i]} + ": " + std::strerror(errno);
+            }
+        }
+#else
+        m_error = "perf_event_open доступен только в Linux";
+#endif
+    }
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+    ~PerfCounters() {
+#ifdef __linux__
+        for (const int fd : m_fds) {
+            if (fd >= 0) {
+                ::close(fd);
+            }
+        }
+#endif
+    }
+
+    void start() noexcept {
+        control(true);
+    }
+    void stop() noexcept {
+        control(false);
+    }
+
+    // Значение счётчика; false — счётчик недоступен
+    bool read(std::size_t kind, std::uint64_t& value) const noexcept {
+#ifdef __linux__
+        return m_fds[kind] >= 0 &&
+               ::read(m_fds[kind], &value, sizeof(value)) ==
+                   static_cast<ssize_t>(sizeof(value));
+#else
+        (void)kind;
+        (void)value;
+        return false;
+#endif
+    }
+
+    [[nodiscard]]
+    const std::string& error() const noexcept {
+        return m_error;
+    }
+private:
+    void control(bool enable) noexcept {
+#ifdef __linux__
+        for (const int fd : m_fds) {
+            if (fd >= 0) {
+                if (enable) {
+                    ::ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+                }
+                ::ioctl(fd,
+                        enable ? PERF_EVENT_IOC_ENABLE : PERF_EVENT_IOC_DISABLE,
+                        0);
+            }
+        }
+#else
+        (void)enable;
+#endif
+    }
+
+    std::array<int, kinds> m_fds{};
+    std::string m_error;
+};
+
+// Операции драйвера над конкретным контейнером
+template <typename Container>
+struct WorkloadOps;
+
+// std::map: вставка, удаление и поиск по ключу (около половины ключей
+// отсутствует), обход — сумма значений
+template <typename Key, typename Value, typename Compare, typename Allocator>
+struct WorkloadOps<std::map<Key, Value, Compare, Allocator>> {
+    using Container = std::map<Key, Value, Compare, Allocator>;
+
+    static void insert(Container& container, int key) {
+        container.try_emplace(key, key);
+    }
+    static void erase(Container& container, int key) {
+        container.erase(key);
+    }
+    static long long lookup(const Container& container, int key) {
+        const auto it = container.find(key);
+        return it == container.end() ? 0 : it->second;
+    }
+    static long long iterate(const Container& container) {
+        long long sum = 0;
+        for (const auto& [key, value] : container) {
+            sum += value;
+        }
+        return sum;
+    }
+};
+
+// MyUniDirListTypeContainer как очередь: вставка в конец, удаление
+// из начала, поиск — доступ по случайному индексу, обход — for_each
+template <typename T, typename Allocator>
+struct WorkloadOps<MyUniDirListTypeContainer<T, Allocator>> {
+    using Container = MyUniDirListTypeContainer<T, Allocator>;
+
+    static void insert(Container& container, int key) {
+        container.push_back(key);
+    }
+    static void erase(Container& container, int) {
+        if (!container.empty()) {
+            container.erase(0);
+        }
+    }
+    static long long lookup(const Container& container, int key) {
+        if (container.empty()) {
+            return 0;
+        }
+        return container[static_cast<std::size_t>(key) % container.size()];
+    }
+    static long long iterate(const Container& container) {
+        long long sum = 0;
+        container.for_each([&sum](const T& value) { sum += value; });
+        return sum;
+    }
+};
+
+namespace workload_detail {
+
+// Значение перцентиля по отсортированной выборке
+inline std::uint64_t percentile(const std::vector<std::uint64_t>& sorted,
+                                double fraction) {
+    if (sorted.empty()) {
+        return 0;
+    }
+    const auto index = static_cast<std::size_t>(
+        fraction * static_cast<double>(sorted.size()));
+    return sorted[std::min(index, sorted.size() - 1)];
+}
+
+inline void writeLatencies(std::ostream& os,
+                           std::vector<std::uint64_t>& latencies) {
+    std::sort(latencies.begin(), latencies.end());
+    os << "{\"count\": " << latencies.size()
+       << ", \"p50\": " << percentile(latencies, 0.5)
+       << ", \"p99\": " << percentile(latencies, 0.99)
+       << ", \"p999\": " << percentile(latencies, 0.999)
+       << ", \"max\": " << (latencies.empty() ? 0 : latencies.back()) << "}";
+}
+
+// Пиковый RSS процесса, КиБ (включает и буферы самого драйвера)
+inline long peakRssKiB() {
+    rusage usage{};
+    return ::getrusage(RUSAGE_SELF, &usage) == 0 ? usage.ru_maxrss : -1;
+}
+
+}  // namespace workload_detail
+
+// Прогон нагрузки на контейнере Container, JSON-отчёт — в os
+template <typename Container>
+void runWorkload(const WorkloadOptions& options, std::ostream& os) {
+    using Ops = WorkloadOps<Container>;
+    using Clock = std::chrono::steady_clock;
+
+    std::mt19937_64 random{options.seed};
+    const int key_range = static_cast<int>(options.count * 2) + 1;
+    std::uniform_int_distribution<int> key_distribution{0, key_range - 1};
+    std::discrete_distribution<unsigned> operation_distribution{
+        options.mix.begin(), options.mix.end()};
+
+    // Начальное заполнение: ключи 0, 2, 4, ... в случайном порядке
+    std::vector<int> initial(options.count);
+    for (std::size_t i = 0; i < initial.size(); ++i) {
+        initial[i] = static_cast<int>(i * 2);
+    }
+    std::shuffle(initial.begin(), initial.end(), random);
+
+    std::vector<WorkloadOperation> schedule(options.operations);
+    std::vector<int> keys(options.operations);
+    for (std::size_t i = 0; i < options.operations; ++i) {
+        schedule[i] =
+            static_cast<WorkloadOperation>(operation_distribution(random));
+        keys[i] = key_distribution(random);
+    }
+
+    Container container;
+    for (const int key : initial) {
+        Ops::insert(container, key);
+    }
+
+    // Буферы задержек выделяются заранее, чтобы не мешать замеру
+    const auto total_share = std::accumulate(
+        options.mix.begin(), options.mix.end(), std::size_t{0});
+    std::array<std::vector<std::uint64_t>, WORKLOAD_OPERATION_KINDS>
+        latencies;
+    for (std::size_t kind = 0; kind < WORKLOAD_OPERATION_KINDS; ++kind) {
+        latencies[kind].reserve(options.operations * options.mix[kind] /
+                                    total_share +
+                                options.operations / 100 + 16);
+    }
+
+    std::unique_ptr<PerfCounters> counters;
+    if (options.perf) {
+        counters = std::make_unique<PerfCounters>();
+        counters->start();
+    }
+    long long checksum = 0;
+    const auto begin = Clock::now();
+    for (std::size_t i = 0; i < options.operations; ++i) {
+        const auto op_begin = Clock::now();
+        switch (schedule[i]) {
+            case WorkloadOperation::Insert:
+                Ops::insert(container, keys[i]);
+                break;
+            case WorkloadOperation::Erase:
+                Ops::erase(container, keys[i]);
+                break;
+            case WorkloadOperation::Lookup:
+                checksum += Ops::lookup(container, keys[i]);
+                break;
+            case WorkloadOperation::Iterate:
+                checksum += Ops::iterate(container);
+                break;
+        }
+        const auto op_end = Clock::now();
+        latencies[static_cast<std::size_t>(schedule[i])].push_back(
+            static_cast<std::uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    op_end - op_begin)
+                    .count()));
+    }
+    const double elapsed =
+        std::chrono::duration<double>(Clock::now() - begin).count();
+    if (counters) {
+        counters->stop();
+    }
+
+    os << "{\n  \"container\": \"" << options.container << "\",\n"
+       << "  \"allocator\": \"" << options.allocator << "\",\n"
+       << "  \"count\": " << options.count << ",\n"
+       << "  \"operations\": " << options.operations << ",\n"
+       << "  \"mix\": {";
+    for (std::size_t kind = 0; kind < WORKLOAD_OPERATION_KINDS; ++kind) {
+        os << (kind ? ", " : "") << "\"" << WORKLOAD_OPERATION_NAMES[kind]
+           << "\": " << options.mix[kind];
+    }
+    os << "},\n  \"seed\": " << options.seed << ",\n"
+       << "  \"elapsed_s\": " << elapsed << ",\n"
+       << "  \"throughput_ops_per_s\": "
+       << (elapsed > 0 ? static_cast<double>(options.operations) / elapsed
+                       : 0.0)
+       << ",\n  \"latency_ns\": {";
+    std::vector<std::uint64_t> all;
+    all.reserve(options.operations);
+    for (std::size_t kind = 0; kind < WORKLOAD_OPERATION_KINDS; ++kind) {
+        all.insert(all.end(), latencies[kind].begin(), latencies[kind].end());
+        os << "\n    \"" << WORKLOAD_OPERATION_NAMES[kind] << "\": ";
+        workload_detail::writeLatencies(os, latencies[kind]);
+        os << ",";
+    }
+    os << "\n    \"all\": ";
+    workload_detail::writeLatencies(os, all);
+    os << "\n  },\n"
+       << "  \"final_size\": " << container.size() << ",\n"
+       << "  \"checksum\": " << checksum << ",\n"
+       << "  \"peak_rss_kib\": " << workload_detail::peakRssKiB() << ",\n"
+       << "  \"perf\": ";
+    if (!counters) {
+        os << "null";
+    } else {
+        os << "{";
+        for (std::size_t kind = 0; kind < PerfCounters::kinds; ++kind) {
+            std::uint64_t value = 0;
+            os << (kind ? ", " : "") << "\"" << PerfCounters::names[kind]
+               << "\": ";
+            if (counters->read(kind, value)) {
+                os << value;
+            } else {
+                os << "null";
+            }
+        }
+        if (!counters->error().empty()) {
+            os << ", \"error\": \"" << counters->error() << "\"";
+        }
+        os << "}";
+    }
+    os << "\n}\n";
+}
+
+namespace workload_detail {
+
+constexpr std::size_t POOL_CHUNK = 1024;
+
+template <typename T>
+using LinearPool = FixedAllocator<T, POOL_CHUNK, GrowthPolicy::Linear>;
+template <typename T>
+using GeometricPool = FixedAllocator<T, POOL_CHUNK, GrowthPolicy::Geometric>;
+template <typename T>
+using HugePagePool = FixedAllocator<T, POOL_CHUNK, GrowthPolicy::Geometric,
+                                    ChunkBacking::HugePages>;
+
+template <template <typename> class Allocator>
+void runWorkloadContainer(const WorkloadOptions& options, std::ostream& os) {
+    if (options.container == "map") {
+        runWorkload<std::map<int, int, std::less<int>,
+                             Allocator<std::pair<const int, int>>>>(options,
+                                                                   os);
+    } else {
+        runWorkload<MyUniDirListTypeContainer<int, Allocator<int>>>(options,
+                                                                    os);
+    }
+}
+
+}  // namespace workload_detail
+
+// Точка входа драйвера: разбор опций, прогон, JSON в os. Код возврата
+// для main: 0 — успех, 1 — нехватка памяти, 2 — ошибка в опциях
+inline int runWorkloadDriver(int argc, char* argv[],
+                             std::ostream& os = std::cout) {
+    WorkloadOptions options;
+    try {
+        if (argc == 2 && std::string_view{argv[1]} == "--help") {
+            printWorkloadUsage(os);
+            return 0;
+        }
+        options = parseWorkloadOptions(argc, argv);
+    } catch (const std::invalid_argument& e) {
+        std::cerr << e.what() << "\n";
+        printWorkloadUsage(std::cerr);
+        return 2;
+    }
+    try {
+        if (options.allocator == "std") {
+            workload_detail::runWorkloadContainer<std::allocator>(options,
+                                                                  os);
+        } else if (options.allocator == "pool-linear") {
+            workload_detail::runWorkloadContainer<workload_detail::LinearPool>(
+                options, os);
+        } else if (options.allocator == "pool-geometric") {
+            workload_detail::runWorkloadContainer<
+                workload_detail::GeometricPool>(options, os);
+        } else {
+            workload_detail::runWorkloadContainer<
+                workload_detail::HugePagePool>(options, os);
+        }
+    } catch (const std::bad_alloc& e) {
+        std::cerr << "Ошибка выделения памяти: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}